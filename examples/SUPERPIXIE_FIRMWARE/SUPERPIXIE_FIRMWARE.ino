@@ -18,6 +18,7 @@
 // Espressif dependencies
 #include "freertos/FreeRTOS.h" // for uxTaskGetStackHighWaterMark()
 #include "freertos/task.h"     // for xTaskGetCurrentTaskHandle()
+#include "freertos/semphr.h"   // for xSemaphoreCreateBinary()
 #include "esp_task_wdt.h"
 #include "esp_system.h" // for esp_get_free_heap_size()
 
@@ -29,17 +30,33 @@
 // Internal dependencies
 #include "constants.h"
 #include "math_utilities.h"
+#include "profiler.h"
+#include "easing.h"
 #include "ascii.h"
+#include "glyph_cache.h"
 #include "dithering.h"
+#include "gamma.h"
 #include "node_fs.h"
+#include "render_state.h"
+#include "parallel_output.h"
 #include "leds.h"
+#include "effects.h"
 #include "system.h"
 #include "transitions.h"
+#include "glyph_sdf.h"
+#include "raster_cache.h"
 #include "vector_drawing.h"
+#include "marquee.h"
+#include "stream.h"
+#include "clock_mode.h"
+#include "sequencer.h"
 #include "test_code.h"
 #include "commands.h"
 #include "uart_chain.h"
+#include "timeline.h"
+#include "compositor.h"
 #include "debug.h"
+#include "telemetry.h"
 
 // #############################################################################################
 // Runs only once at startup
@@ -90,14 +107,15 @@ void loop() {
 
 
 // #############################################################################################
-// Core 0: "GPU CORE" handles vector rasterization, transitions, dithering, and LED updating
-void loop_gpu(void *parameter) {
-  // Register task to watchdog
-  esp_task_wdt_add(NULL);
-
+// Core 0: set up everything the GPU core draws with
+void init_gpu() {
   //---------------------------
   // Initialize the LED Highway
   init_leds();
+  build_gamma_lut();
+  init_easing_curves();
+  init_effects();
+  init_compositor();
   //---------------------------
 
   CRGBF color = BOOT_COLOR;
@@ -105,6 +123,72 @@ void loop_gpu(void *parameter) {
 
   //set_new_character(' ');
   //trigger_transition();
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Core 0: render and send out one frame. Kept apart from loop_gpu() so the native benchmark
+// (extras/native) runs exactly the same frame as the hardware does.
+void render_frame() {
+  // -----------------------------------------------------------------
+  // Note the current time in milliseconds and microcseconds this loop
+  time_us_now = micros();
+  time_ms_now = millis();
+  // -----------------------------------------------------------------
+
+  last_gpu_check_in = time_ms_now;
+
+  // ----------------------------------------------
+  // Pick up the CPU core's latest changes, start any queued sequence step or clock tick, then
+  // run transitions and system state interpolation
+  apply_render_state();
+  run_sequence_queue();
+  run_clock();
+  profile_lap(PROFILE_RENDER_STATE);
+
+  run_system_transition();
+  profile_lap(PROFILE_TRANSITION);
+  // ----------------------------------------------
+
+  // ------------------------------------------------------------------------
+  // Composite the background, characters, debug LEDs, effects and touch glow layers
+  // (compositor.h), skipped entirely on frames where none of them changed. Each layer is
+  // profiled separately inside.
+  composite_layers();
+  // ------------------------------------------------------------------------
+
+  //dump_last_packet_info_to_screen();
+
+  // ------------------------------------------------------------------------
+  // Apply global brightness level, and frame blending to simulate motion blur or phosphor
+  // decay
+  apply_brightness_and_frame_blending();
+  profile_lap(PROFILE_BRIGHTNESS);
+  // ------------------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  // Quantize the LED image and hand it off to be sent down all 7 lanes of the LED highway
+  update_leds();
+  profile_lap(PROFILE_OUTPUT);
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------------
+  // Add this frame's stage timings to the profiler's histograms, read back by the host with
+  // COM_GET_FPS
+  profile_end_frame();
+  // --------------------------------------------------------------------
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Core 0: "GPU CORE" handles vector rasterization, transitions, dithering, and LED updating
+void loop_gpu(void *parameter) {
+  // Register task to watchdog
+  esp_task_wdt_add(NULL);
+
+  init_gpu();
 
   while(system_ready == false){
     delay(10);
@@ -114,68 +198,7 @@ void loop_gpu(void *parameter) {
     // Watchdog check-in
     esp_task_wdt_reset();
 
-    // -----------------------------------------------------------------
-    // Note the current time in milliseconds and microcseconds this loop
-    time_us_now = micros();
-    time_ms_now = millis();
-    // -----------------------------------------------------------------
-
-    last_gpu_check_in = time_ms_now;
-
-    // ----------------------------------------------
-    // Run transitions and system state interpolation
-    run_system_transition();
-    // ----------------------------------------------
-
-    if (freeze_led_image == false) {
-      // ---------------------------
-      // Reset output image to black
-      clear_leds();
-      // ---------------------------
-
-      // -------------------------------------------------------------
-      // Draw the background gradient to the display after clearing it
-      draw_background_gradient();
-      // -------------------------------------------------------------
-
-      // ------------------------------------------------
-      // Draw characters to the screen via the rasterizer
-      draw_characters();
-      // ------------------------------------------------
-
-      // --------------------------
-      // Update the backlight color
-      draw_backlight();
-      // --------------------------
-
-      draw_debug_leds();
-
-      //dump_last_packet_info_to_screen();
-
-      draw_ripple();
-
-      draw_touch();
-
-      // ------------------------------------------------------------------------
-      // Apply global brightness level
-      apply_brightness();
-      // ------------------------------------------------------------------------
-    }
-
-    // ------------------------------------------------------------------------
-    // Apply frame blending algorithm to simulate motion blur or phosphor decay
-    apply_frame_blending();
-    // ------------------------------------------------------------------------
-
-    // --------------------------------------------------------------
-    // Send the updated LED image down all 7 lanes of the LED highway
-    update_leds();
-    // --------------------------------------------------------------
-
-    // -----------------------
-    // Measure the current FPS
-    //watch_fps();
-    // -----------------------
+    render_frame();
 
     //watch_heap();
     //watch_stack();
@@ -189,6 +212,30 @@ void loop_gpu(void *parameter) {
 }
 
 
+// #############################################################################################
+// Core 1: one pass over everything the CPU core keeps up with. Like render_frame(), kept apart
+// from loop_cpu() for the native benchmark.
+void run_cpu_tasks() {
+  check_reset();
+  check_data();
+  check_touch();
+  check_transition_completion();
+  run_timeline();
+
+  run_chain_discovery();
+  receive_chain_data();
+
+  // Hand everything changed above to the GPU core as a single snapshot
+  publish_render_state();
+
+  //debugln(uart0_fifo_available());
+
+  // Trickle out a binary snapshot of the stats every TELEMETRY_INTERVAL_MS (telemetry.h)
+  run_telemetry();
+}
+// #############################################################################################
+
+
 // #############################################################################################
 // Core 1: "CPU CORE" handles UART chain communication, touch sensing and system configuration
 void loop_cpu(void *parameter) {
@@ -203,16 +250,7 @@ void loop_cpu(void *parameter) {
   system_ready = true;
 
   while (1) {
-    check_reset();
-    check_data();
-    check_touch();
-    check_transition_completion();
-
-    run_chain_discovery();
-    receive_chain_data();
-
-    //debugln(uart0_fifo_available());
-    //print_dump(250);
+    run_cpu_tasks();
 
     yield(); // Keep watchdog timer happy 
   }
@@ -0,0 +1,187 @@
+// #############################################################################################
+// Clock and counter mode
+//
+// Clocks and counters used to need a set_string() from the host every second. Instead, the host
+// can send COM_SET_CLOCK once with a starting value, how much it changes every tick, and a
+// format shared by the whole chain, and each node works out its own character from then on.
+//
+// The format has one character per node, starting at (first_address). Letters stand for digits
+// of a field, and runs of the same letter are read as one number, right aligned:
+//
+//   H  Hours, 00-23        M  Minutes, 00-59       D  The value itself, for counters
+//   I  Hours, 01-12        S  Seconds, 00-59
+//
+// The time fields read the value as seconds since midnight. The same letters in lower case
+// leave leading zeros blank, and anything else is shown as it is, like the ':' in "HH:MM:SS" or
+// the "d" digits of "dddd" counting up from 0 as "   0", "   1", ...
+//
+// The base value is shown as soon as the packet arrives. Like the marquee (marquee.h), the
+// first tick comes (delay_ms) after that, less CHAIN_BYTE_TIME_US for every node the packet
+// passed through, so every digit changes on the same frame. For a clock, (delay_ms) is the time
+// left until the next second. Node clocks do drift apart slowly, so long running clocks should
+// be set again every so often.
+//
+// Like the marquee's, the settings (clock_settings in constants.h) are staged in
+// RENDER_STATE_STAGED.CLOCK and reach the GPU core with the rest of the render state.
+
+#define CLOCK_HEADER 12  // Settings bytes ahead of the format
+#define CLOCK_FLAG_STOP_AT_ZERO (0x01)  // Count down to 0 and stay there
+
+clock_settings clock_mode;  // Only ever touched by the GPU core
+char clock_character = 0;   // Last character shown, 0 to show the next one whatever it is
+bool clock_started = false; // Set at the first tick, after that millis() is free to wrap
+
+uint32_t clock_ticks_shown = 0;
+
+// #############################################################################################
+// The character at (position) of (format) for the clock or counter value (value)
+char get_clock_character(const clock_settings& settings, int32_t value) {
+  char token = settings.FORMAT[settings.POSITION];
+
+  int32_t time_of_day = ((value % 86400) + 86400) % 86400;
+  int32_t field = 0;
+
+  char upper_token = toupper(token);
+  if (upper_token == 'H') {
+    field = time_of_day / 3600;
+  }
+  else if (upper_token == 'I') {
+    field = (time_of_day / 3600) % 12;
+    if (field == 0) {
+      field = 12;
+    }
+  }
+  else if (upper_token == 'M') {
+    field = (time_of_day / 60) % 60;
+  }
+  else if (upper_token == 'S') {
+    field = time_of_day % 60;
+  }
+  else if (upper_token == 'D') {
+    field = (value > 0) ? value : 0;
+  }
+  else {
+    return token;
+  }
+
+  // Which digit of the field this is, counting from the right end of its run of letters
+  uint32_t divisor = 1;
+  for (uint8_t i = settings.POSITION + 1; i < settings.FORMAT_LENGTH && settings.FORMAT[i] == token; i++) {
+    if (divisor >= 1000000000) {
+      return ' ';  // More digits than a 32-bit value has
+    }
+    divisor *= 10;
+  }
+
+  if (token != upper_token && divisor > 1 && uint32_t(field) < divisor) {
+    return ' ';  // Leading zero
+  }
+
+  return '0' + (field / divisor) % 10;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: start, replace or stop the clock, called by apply_render_state() when the CPU core
+// has staged new settings
+void apply_clock_settings(const clock_settings& settings) {
+  memcpy(&clock_mode, &settings, sizeof(clock_settings));
+  clock_character = 0;
+  clock_started = false;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: transition to a new character whenever a tick changes this node's digit, called
+// once per frame
+void run_clock() {
+  if (clock_mode.POSITION >= clock_mode.FORMAT_LENGTH) {
+    return;  // Off, or the format doesn't reach this node
+  }
+
+  if (transition_running == true) {
+    return;  // Catch up once the last one has finished
+  }
+
+  if (clock_started == false && int32_t(time_ms_now - clock_mode.START_MS) >= 0) {
+    clock_started = true;
+  }
+
+  int64_t value = clock_mode.BASE;
+  if (clock_started == true) {
+    uint32_t ticks = (time_ms_now - clock_mode.START_MS) / clock_mode.TICK_MS + 1;
+    value += int64_t(clock_mode.STEP) * ticks;
+  }
+
+  if ((clock_mode.FLAGS & CLOCK_FLAG_STOP_AT_ZERO) && (value < 0) != (clock_mode.BASE < 0)) {
+    value = 0;
+  }
+  if (value > INT32_MAX) {
+    value = INT32_MAX;
+  }
+  else if (value < INT32_MIN) {
+    value = INT32_MIN;
+  }
+
+  char character = get_clock_character(clock_mode, value);
+  if (character == clock_character) {
+    return;
+  }
+  clock_character = character;
+
+  // The same transition a show() would use, without reporting back to the host
+  load_new_character(character);
+  start_transition(SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE, SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_DURATION_MS, false);
+
+  clock_ticks_shown++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: stage the clock from a COM_SET_CLOCK packet for the GPU core. (data) is a flags
+// byte, the base value as a big endian 32-bit value, then the step, tick length and start delay
+// in milliseconds as big endian 16-bit values, the address of the first node, and then the
+// format. An empty format stops the clock, leaving the last character on screen.
+void set_clock_packet(const uint8_t* data, uint8_t data_length, uint8_t local_address, bool bus_mode) {
+  uint32_t arrival_ms = millis();
+
+  if (data_length < CLOCK_HEADER) {
+    return;
+  }
+
+  uint8_t format_length = data_length - CLOCK_HEADER;
+  if (format_length > CLOCK_MAX_FORMAT) {
+    format_length = CLOCK_MAX_FORMAT;
+  }
+
+  uint16_t tick_ms = (data[7] << 8) + data[8];
+  uint16_t delay_ms = (data[9] << 8) + data[10];
+  uint8_t first_address = data[11];
+
+  if (tick_ms == 0) {
+    format_length = 0;
+  }
+
+  clock_settings& staged = RENDER_STATE_STAGED.CLOCK;
+  staged.FLAGS = data[0];
+  staged.BASE = int32_t((uint32_t(data[1]) << 24) + (uint32_t(data[2]) << 16) + (uint32_t(data[3]) << 8) + data[4]);
+  staged.STEP = int16_t((data[5] << 8) + data[6]);
+  staged.TICK_MS = tick_ms;
+  staged.POSITION = local_address - first_address;  // Wraps past the end below (first_address)
+  staged.FORMAT_LENGTH = format_length;
+  memcpy(staged.FORMAT, &data[CLOCK_HEADER], format_length);
+
+  // On a bus every node hears the packet at the same time
+  uint32_t hop_delay_ms = 0;
+  if (bus_mode == false) {
+    hop_delay_ms = (uint32_t(local_address) * CHAIN_BYTE_TIME_US) / 1000;
+  }
+  staged.START_MS = arrival_ms + delay_ms - hop_delay_ms;
+
+  RENDER_STATE_STAGED.CLOCK_SERIAL++;
+  render_state_dirty = true;
+}
+// #############################################################################################
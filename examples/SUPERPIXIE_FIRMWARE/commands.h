@@ -34,6 +34,18 @@ typedef enum {
   /* 31 */ COM_READ_TOUCH_RESPONSE,
   /* 32 */ COM_SET_TOUCH_THRESHOLD,
   /* 33 */ COM_SAVE_STORAGE,
+  /* 34 */ COM_SET_GAMMA_CURVE,
+  /* 35 */ COM_SET_DITHER_MODE,
+  /* 36 */ COM_SPAWN_EFFECT,
+  /* 37 */ COM_SET_EASING_CURVE,
+  /* 38 */ COM_SET_TRANSITION_TRACK,
+  /* 39 */ COM_QUEUE_SEQUENCE,
+  /* 40 */ COM_SET_MARQUEE,
+  /* 41 */ COM_STREAM_FRAME,
+  /* 42 */ COM_TIMELINE_ADD,
+  /* 43 */ COM_TIMELINE_CONTROL,
+  /* 44 */ COM_SET_CLOCK,
+  /* 45 */ COM_FPS_RESPONSE,
   
   NUM_COMMANDS
 } command_t;
\ No newline at end of file
@@ -0,0 +1,169 @@
+// #############################################################################################
+// Layered compositor
+//
+// Every frame's image is built from a stack of up to COMPOSITOR_MAX_LAYERS layers, bottom to
+// top: the background, both character slots, a frame streamed from the host, the debug LEDs,
+// the effect pool and the touch glow. Each layer has a blend mode and an opacity, and two
+// callbacks (see compositor_layer in constants.h). New effects only need a layer added in
+// init_compositor(), the GPU loop stays the same.
+//
+// All visible layers are fused into a single pass over the display: each pixel runs through
+// the whole stack before moving on to the next one, instead of every effect making its own pass
+// over leds[][]. When no layer is dirty, and no layer's visibility or opacity has changed, the
+// last composite in leds[][] is reused and the pass is skipped entirely.
+//
+// The backlight LED (leds[3][15]) sits outside of the display, so draw_backlight() sets it
+// directly before the layers are prepared, which may then tint it.
+
+#define COMPOSITOR_MAX_LAYERS 12
+
+compositor_layer compositor_layers[COMPOSITOR_MAX_LAYERS];
+uint8_t compositor_layer_count = 0;
+
+bool compositor_valid = false;  // False until leds[][] holds a composite that can be reused
+
+uint32_t compositor_passes = 0;   // Frames composited since boot
+uint32_t compositor_skipped = 0;  // Frames that reused the last composite
+
+// Defined in debug.h, which is included after this file
+extern bool prepare_debug_layer(compositor_layer& layer);
+extern void debug_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha);
+
+// #############################################################################################
+// Add a layer to the top of the stack, returning its index or -1 if the stack is full. (source)
+// can be NULL for BLEND_DESATURATE layers, which ignore the layer's own color. The time spent
+// preparing the layer is charged to (profile_stage), one of profile_stages.
+int8_t add_compositor_layer(uint8_t blend_mode, bool (*prepare)(compositor_layer&), void (*source)(const compositor_layer&, uint8_t, uint8_t, CRGBF&, float&), uint8_t profile_stage, uint8_t parameter = 0) {
+  if (compositor_layer_count >= COMPOSITOR_MAX_LAYERS) {
+    return -1;
+  }
+
+  compositor_layer& layer = compositor_layers[compositor_layer_count];
+  layer.BLEND_MODE = blend_mode;
+  layer.OPACITY = 1.0;
+  layer.PARAMETER = parameter;
+  layer.PREPARE = prepare;
+  layer.SOURCE = source;
+  layer.DIRTY = true;
+  layer.VISIBLE = false;
+  layer.COMPOSITED_OPACITY = 1.0;
+  layer.PROFILE_STAGE = profile_stage;
+
+  compositor_valid = false;
+
+  return compositor_layer_count++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Build the default layer stack
+void init_compositor() {
+  compositor_layer_count = 0;
+
+  add_compositor_layer(BLEND_REPLACE, prepare_background_layer, background_layer_source, PROFILE_BACKGROUND);
+  add_compositor_layer(BLEND_ADD, prepare_character_layer, character_layer_source, PROFILE_CHARACTERS, 0);
+  add_compositor_layer(BLEND_ADD, prepare_character_layer, character_layer_source, PROFILE_CHARACTERS, 1);
+  add_compositor_layer(BLEND_REPLACE, prepare_stream_layer, stream_layer_source, PROFILE_STREAM);
+  add_compositor_layer(BLEND_MIX, prepare_debug_layer, debug_layer_source, PROFILE_DEBUG);
+  add_compositor_layer(BLEND_ADD, prepare_effects_layer, effects_layer_source, PROFILE_EFFECTS);
+  add_compositor_layer(BLEND_DESATURATE, prepare_touch_layer, NULL, PROFILE_TOUCH);
+  add_compositor_layer(BLEND_MULTIPLY, prepare_touch_dim_layer, touch_dim_layer_source, PROFILE_TOUCH);
+  add_compositor_layer(BLEND_MIX, prepare_touch_glow_layer, touch_glow_layer_source, PROFILE_TOUCH);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Blend (color) onto (below) with one of the blend_modes, (amount) being the layer's opacity
+// times its alpha at this pixel
+inline CRGBF blend_layer(CRGBF below, CRGBF color, uint8_t blend_mode, float amount) {
+  if (blend_mode == BLEND_REPLACE) {
+    return color;
+  }
+  else if (blend_mode == BLEND_ADD) {
+    below.r = add_clipped_float(below.r, color.r * amount);
+    below.g = add_clipped_float(below.g, color.g * amount);
+    below.b = add_clipped_float(below.b, color.b * amount);
+    return below;
+  }
+  else if (blend_mode == BLEND_MIX) {
+    return interpolate_CRGBF(below, color, amount);
+  }
+  else if (blend_mode == BLEND_MULTIPLY) {
+    CRGBF multiplied = { below.r * color.r, below.g * color.g, below.b * color.b };
+    if (amount >= 1.0) {
+      return multiplied;
+    }
+    return interpolate_CRGBF(below, multiplied, amount);
+  }
+  else if (blend_mode == BLEND_DESATURATE) {
+    return desaturate(below, amount);
+  }
+
+  return below;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Prepare every layer, then composite the visible ones into leds[][] if anything has changed
+void composite_layers() {
+  draw_backlight();
+  profile_lap(PROFILE_BACKLIGHT);
+
+  bool changed = (compositor_valid == false);
+
+  for (uint8_t i = 0; i < compositor_layer_count; i++) {
+    compositor_layer& layer = compositor_layers[i];
+
+    bool visible = layer.PREPARE(layer);
+    if (visible != layer.VISIBLE) {
+      changed = true;
+    }
+    else if (visible == true && (layer.DIRTY == true || layer.OPACITY != layer.COMPOSITED_OPACITY)) {
+      changed = true;
+    }
+
+    layer.VISIBLE = visible;
+    profile_lap(layer.PROFILE_STAGE);
+  }
+
+  if (changed == false) {
+    compositor_skipped++;
+    return;
+  }
+
+  for (uint8_t x = 0; x < LEDS_X; x++) {
+    for (uint8_t y = 0; y < LEDS_Y; y++) {
+      CRGBF pixel = { 0.0, 0.0, 0.0 };
+
+      for (uint8_t i = 0; i < compositor_layer_count; i++) {
+        const compositor_layer& layer = compositor_layers[i];
+        if (layer.VISIBLE == false) {
+          continue;
+        }
+
+        CRGBF color = { 0.0, 0.0, 0.0 };
+        float alpha = 1.0;
+        if (layer.SOURCE != NULL) {
+          layer.SOURCE(layer, x, y, color, alpha);
+        }
+
+        pixel = blend_layer(pixel, color, layer.BLEND_MODE, layer.OPACITY * alpha);
+      }
+
+      leds[x][y] = pixel;
+    }
+  }
+
+  for (uint8_t i = 0; i < compositor_layer_count; i++) {
+    compositor_layers[i].DIRTY = false;
+    compositor_layers[i].COMPOSITED_OPACITY = compositor_layers[i].OPACITY;
+  }
+
+  compositor_valid = true;
+  compositor_passes++;
+  profile_lap(PROFILE_COMPOSITE);
+}
+// #############################################################################################
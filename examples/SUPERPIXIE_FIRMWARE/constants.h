@@ -2,12 +2,24 @@
 #define chain_left Serial2
 #define chain_right Serial
 
+// One 10-bit UART frame at DEFAULT_CHAIN_BAUD (9600), about how much later each node down the
+// chain sees a packet than the node before it, since packets are forwarded a byte at a time
+#define CHAIN_BYTE_TIME_US (1042)
+
 #define DEBUG_MODE 0
 
 #define RESET_PULSE_DURATION_MS (50)
 
 #define TOUCH_PIN 13
 
+// Set to 1 to clock all 7 LED lanes out at once through the I2S peripheral (parallel_output.h)
+// instead of calling showLeds() on each lane's CLEDController in turn
+#define LED_OUTPUT_PARALLEL 0
+
+// Set to 1 to draw characters by sampling a distance field built once per glyph (glyph_sdf.h)
+// instead of testing every pixel against every line segment of the glyph each frame
+#define GLYPH_RENDER_SDF 0
+
 // A list of all possible transition types
 enum transitions {
   TRANSITION_INSTANT,
@@ -24,10 +36,26 @@ enum transitions {
   TRANSITION_PUSH_DOWN,
   TRANSITION_PUSH_LEFT,
   TRANSITION_PUSH_RIGHT,
+  TRANSITION_CUSTOM_A,  // Uploaded by the host with COM_SET_TRANSITION_TRACK, a crossfade until then
+  TRANSITION_CUSTOM_B,
+  TRANSITION_CUSTOM_C,
+  TRANSITION_CUSTOM_D,
 
   NUM_TRANSITIONS
 };
 
+// A list of all character_state properties a transition can animate (transitions.h)
+enum transition_properties {
+  TRANSITION_OPACITY,
+  TRANSITION_POSITION_X,
+  TRANSITION_POSITION_Y,
+  TRANSITION_SCALE_X,
+  TRANSITION_SCALE_Y,
+  TRANSITION_ROTATION,
+
+  NUM_TRANSITION_PROPERTIES
+};
+
 // A list of all possible gradient types
 enum gradient_directions {
   GRADIENT_NONE,
@@ -47,6 +75,114 @@ enum interpolation_types {
   EASE_OUT_SOFT,
   S_CURVE,
   S_CURVE_SOFT,
+  CUSTOM_CURVE_A,  // Uploaded by the host with COM_SET_EASING_CURVE, linear until then
+  CUSTOM_CURVE_B,
+  CUSTOM_CURVE_C,
+  CUSTOM_CURVE_D,
+
+  NUM_INTERPOLATION_TYPES
+};
+
+#define NUM_CUSTOM_CURVES (NUM_INTERPOLATION_TYPES - CUSTOM_CURVE_A)
+
+// A list of all possible gamma/transfer curves used when quantizing the image for the LEDs
+enum gamma_curves {
+  GAMMA_LINEAR,
+  GAMMA_SQUARE,
+  GAMMA_POWER,
+  GAMMA_SRGB,
+
+  NUM_GAMMA_CURVES
+};
+
+// A list of all possible temporal dithering modes
+enum dither_modes {
+  DITHER_FIXED,
+  DITHER_ADAPTIVE,
+
+  NUM_DITHER_MODES
+};
+
+// A list of all possible ways a compositor layer can be blended onto the layers below it
+enum blend_modes {
+  BLEND_REPLACE,     // Layer replaces everything below it
+  BLEND_ADD,         // Layer is added to the layers below, clipping at 1.0
+  BLEND_MIX,         // Layer is faded in over the layers below
+  BLEND_MULTIPLY,    // Layers below are multiplied by the layer
+  BLEND_DESATURATE,  // Layers below are desaturated, the layer's own color is ignored
+};
+
+// A list of all possible effects run by the effect pool (effects.h)
+enum effect_types {
+  EFFECT_RIPPLE,   // Horizontal band moving up or down the display
+  EFFECT_SWEEP,    // Vertical band moving left or right across the display
+  EFFECT_SPARKLE,  // Random pixels twinkling, WIDTH is the fraction of pixels lit at once
+  EFFECT_PULSE,    // Whole display washed with the effect's color
+
+  NUM_EFFECT_TYPES
+};
+
+// A list of all encodings a COM_STREAM_FRAME packet can carry (stream.h)
+enum stream_encodings {
+  STREAM_RGB,          // 3 bytes per pixel
+  STREAM_PALETTE,      // A 4-bit palette index per pixel, two pixels per byte, high nibble first
+  STREAM_RLE,          // One byte per run of up to 16 pixels, run length - 1 in the high nibble,
+                       // palette index in the low nibble
+  STREAM_SET_PALETTE,  // 3 bytes per palette entry, starting at the entry in the offset byte
+  STREAM_STOP,         // Go back to drawing characters
+
+  NUM_STREAM_ENCODINGS
+};
+
+// A list of all operations a COM_TIMELINE_CONTROL packet can ask for (timeline.h)
+enum timeline_operations {
+  TIMELINE_CLEAR,   // Drop every entry
+  TIMELINE_PLAY,    // Play from a position, with new flags and loop length
+  TIMELINE_PAUSE,
+  TIMELINE_RESUME,  // Carry on from where it was paused
+  TIMELINE_SEEK,    // Move the playhead, playing or not
+  TIMELINE_SAVE,    // Write the timeline to LittleFS with new flags and loop length
+  TIMELINE_LOAD,    // Replace the timeline with the one saved in LittleFS
+
+  NUM_TIMELINE_OPERATIONS
+};
+
+// A list of all stages of loop_gpu() timed by the frame profiler (profiler.h)
+enum profile_stages {
+  PROFILE_FRAME,         // The whole frame, from the end of the last one
+  PROFILE_RENDER_STATE,  // apply_render_state(), the sequence queue and clock ticks
+  PROFILE_TRANSITION,    // System state interpolation
+  PROFILE_BACKLIGHT,
+  PROFILE_BACKGROUND,
+  PROFILE_CHARACTERS,    // Character transitions and both slots' masks
+  PROFILE_STREAM,
+  PROFILE_DEBUG,
+  PROFILE_EFFECTS,
+  PROFILE_TOUCH,
+  PROFILE_COMPOSITE,     // The fused pass over every visible layer
+  PROFILE_BRIGHTNESS,    // Global brightness and frame blending
+  PROFILE_OUTPUT,        // Quantizing and handing off to the LED highway
+
+  NUM_PROFILE_STAGES
+};
+
+// Types of the values in a telemetry record (telemetry.h), in the order of telemetry_type_sizes
+enum telemetry_types {
+  TELEMETRY_BOOL,
+  TELEMETRY_U8,
+  TELEMETRY_U16,
+  TELEMETRY_U32,
+  TELEMETRY_I32,
+  TELEMETRY_FLOAT,
+
+  NUM_TELEMETRY_TYPES
+};
+
+enum telemetry_record_types {
+  TELEMETRY_RECORD_SCHEMA,  // Names and types of the fields
+  TELEMETRY_RECORD_DATA,    // One snapshot of their values
+
+  NUM_TELEMETRY_RECORD_TYPES
 };
 
 // A list of abstract "positions"
@@ -71,6 +207,16 @@ struct vec2D {
   float y;
 };
 
+// transform_2D: A 2D affine transform, mapping (x, y) to (m00*x + m01*y + tx, m10*x + m11*y + ty)
+struct transform_2D {
+  float m00;
+  float m01;
+  float m10;
+  float m11;
+  float tx;
+  float ty;
+};
+
 // line: Stores a start and end coordinate of a line segment in 2D space
 struct line {
   float x1;
@@ -79,6 +225,21 @@ struct line {
   float y2;
 };
 
+// font_glyph: Where the vertices and lines of a single character are found in the font tables
+// generated into ascii.h by scripts/font_compiler.py
+struct font_glyph {
+  uint16_t first_vertex;
+  uint16_t first_line;
+  uint8_t num_vertices;
+  uint8_t num_lines;
+};
+
+// font_line: A line segment of a font glyph, stored as indices into the glyph's vertices
+struct font_line {
+  uint8_t start;
+  uint8_t end;
+};
+
 CRGBF BOOT_COLOR = { 1.00, 0.00, 0.25 };
 
 // system_state: Everything you can configure about a SuperPixie, in one place.
@@ -118,6 +279,92 @@ struct character_state {
   float OPACITY;
 };
 
+// compositor_layer: One entry in the compositor's layer list, see compositor.h. PREPARE runs
+// once per frame, returning false to hide the layer for that frame, and sets DIRTY whenever the
+// layer's content has changed. SOURCE then gives the layer's color and alpha at each pixel.
+struct compositor_layer {
+  uint8_t BLEND_MODE;
+  float OPACITY;
+  uint8_t PARAMETER;  // Passed through to PREPARE and SOURCE, like which character slot to draw
+  bool (*PREPARE)(compositor_layer& layer);
+  void (*SOURCE)(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha);
+  bool DIRTY;
+  bool VISIBLE;              // Whether the layer was part of the last composite
+  float COMPOSITED_OPACITY;  // OPACITY as of the last composite
+  uint8_t PROFILE_STAGE;     // Where the frame profiler charges PREPARE's time
+};
+
+// effect_parameters: Everything about a single effect in the effect pool, each value is
+// interpolated from its _START to its _END over DURATION_MS with INTERPOLATION
+struct effect_parameters {
+  uint8_t TYPE;
+  uint8_t INTERPOLATION;
+  CRGBF COLOR_START;
+  CRGBF COLOR_END;
+  float POSITION_START;  // Center of the band, in LEDs
+  float POSITION_END;
+  float WIDTH_START;     // Distance from the center where the band fades out, in LEDs
+  float WIDTH_END;
+  float OPACITY_START;
+  float OPACITY_END;
+  uint16_t DURATION_MS;
+  uint16_t DELAY_MS;     // Time from spawning until the effect starts
+};
+
+// sequence_step: One character in a node's sequence queue (sequencer.h), shown with its own
+// transition and then held on screen before the next step starts
+struct sequence_step {
+  char CHARACTER;
+  uint8_t TRANSITION_TYPE;
+  uint16_t TRANSITION_DURATION_MS;
+  uint16_t HOLD_MS;
+};
+
+// transition_keyframe: One keyframe of a transition track (transitions.h), where TIME counts
+// TRANSITION_KEYFRAME_STEPS steps from the start (0) to the end of the transition
+struct transition_keyframe {
+  uint8_t TIME;
+  float VALUE;
+};
+
+#define TRANSITION_MAX_KEYFRAMES 8  // Per custom track
+
+// custom_transition_track: One track of an uploaded transition, holding its own keyframes
+struct custom_transition_track {
+  uint8_t SLOT;
+  uint8_t PROPERTY;
+  uint8_t NUM_KEYFRAMES;
+  transition_keyframe KEYFRAMES[TRANSITION_MAX_KEYFRAMES];
+};
+
+#define MARQUEE_MAX_LENGTH 48  // Characters, after the 6 bytes of settings in COM_SET_MARQUEE
+
+// marquee_settings: A string scrolling across the chain (marquee.h), as seen by one node
+struct marquee_settings {
+  char STRING[MARQUEE_MAX_LENGTH];
+  uint8_t LENGTH;      // 0 when stopped
+  bool LOOP;
+  float SPEED;         // LEDs per second
+  float PITCH;         // LEDs from one character to the next
+  uint32_t START_MS;   // Local millis() when the first character enters from the right
+  uint8_t LOCAL_ADDRESS;
+  uint8_t CHAIN_LENGTH;
+};
+
+#define CLOCK_MAX_FORMAT 32
+
+// clock_settings: A clock or counter run by the whole chain (clock_mode.h), as seen by one node
+struct clock_settings {
+  char FORMAT[CLOCK_MAX_FORMAT];
+  uint8_t FORMAT_LENGTH;  // 0 when off
+  uint8_t POSITION;       // Which character of the format this node shows
+  uint8_t FLAGS;
+  int32_t BASE;           // Value until the first tick
+  int16_t STEP;           // Added every tick
+  uint16_t TICK_MS;
+  uint32_t START_MS;      // Local millis() of the first tick
+};
+
 // Default values for system_state's on boot.
 system_state SYSTEM_STATE_DEFAULTS = {
   0.5,                        // BRIGHTNESS
@@ -40,8 +40,12 @@ void draw_chain_length(uint8_t chain_length) {
   }
 }
 
-void draw_debug_leds() {
+// #############################################################################################
+// Compositor layer: chain status LEDs, faded in over the display by debug_led_opacity
+bool prepare_debug_layer(compositor_layer& layer) {
   if (debug_led_opacity > 0.0) {
+    memset(leds_debug, 0, sizeof(CRGBF) * LEDS_X * NUM_LEDS_PER_STRIP);
+
     draw_debug_address(CHAIN_CONFIG.LOCAL_ADDRESS);
     draw_chain_length(CHAIN_CONFIG.CHAIN_LENGTH);
 
@@ -82,168 +86,19 @@ void draw_debug_leds() {
     leds_debug[3][0] = { 0.0, float(CHAIN_CONFIG.PROPAGATION_MODE) * 0.5F, 0.0 };
     leds_debug[3][1] = { 0.0, float(CHAIN_CONFIG.BUS_MODE) * 0.5F, 0.0 };
 
-    for (uint8_t x = 0; x < LEDS_X; x++) {
-      for (uint8_t y = 0; y < LEDS_Y; y++) {
-        leds[x][y].r = leds[x][y].r * (1.0 - debug_led_opacity) + leds_debug[x][y].r * debug_led_opacity;
-        leds[x][y].g = leds[x][y].g * (1.0 - debug_led_opacity) + leds_debug[x][y].g * debug_led_opacity;
-        leds[x][y].b = leds[x][y].b * (1.0 - debug_led_opacity) + leds_debug[x][y].b * debug_led_opacity;
-      }
-    }
+    layer.OPACITY = debug_led_opacity;
+    layer.DIRTY = true;  // The activity LEDs flash from frame to frame
+    return true;
   }
-}
-
-
-void print_dump(uint32_t interval_ms) {
-  static uint32_t t_last = time_ms_now;
-
-  if ((time_ms_now - t_last) >= interval_ms) {
-    t_last = time_ms_now;
-
-    Serial.print(CHAIN_CONFIG.LOCAL_ADDRESS);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-    Serial.print(CHAIN_CONFIG.CHAIN_LENGTH);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-    Serial.print(CHAIN_CONFIG.PROPAGATION_MODE);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-    Serial.print(CHAIN_CONFIG.BUS_MODE);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(last_probe_tx_time_ms);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(probe_timeout_ms);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(probe_timeout_occurred);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(probe_packet_received);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(terminating_node);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(propagation_queued);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(assignment_complete);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(discovery_complete);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(rx_drop_start);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(rx_drop_duration);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(rx_low);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(show_called_once);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(upstream_packets_receieved);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(time_ms_now);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(time_us_now);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(esp_get_free_heap_size());
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(uxTaskGetStackHighWaterMark(cpu_task));
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(uxTaskGetStackHighWaterMark(gpu_task));
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(frame_blending_amount);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
 
-    Serial.print(debug_led_opacity);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(fade_in_complete);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(GLOBAL_LED_BRIGHTNESS);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(freeze_led_image);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(transition_complete_flag);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(system_state_changed);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(current_system_state);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(system_state_transition_progress);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(system_state_transition_progress_shaped);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(transition_start_ms);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(transition_end_ms);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(transition_running);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(last_gpu_check_in);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(system_ready);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(SYSTEM_STATE.BRIGHTNESS);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(SYSTEM_STATE.TRANSITION_TYPE);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(SYSTEM_STATE.TRANSITION_DURATION_MS);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(SYSTEM_STATE.TOUCH_ACTIVE);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(SYSTEM_STATE.TOUCH_VALUE);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(STORAGE.TOUCH_THRESHOLD);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(STORAGE.TOUCH_HIGH_LEVEL);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(STORAGE.TOUCH_LOW_LEVEL);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(character_state_changed);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(current_character_state);
-    Serial.print("\t\t\t\t\t\t\t\t\t\t");
-
-    Serial.print(dither_index);
-    //Serial.print(" \t ");
-    
+  return false;
+}
 
-    Serial.println();
-  }
+void debug_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  color = leds_debug[x][y];
 }
+// #############################################################################################
+
 
 // Returns the number of bytes available in UART0's hardware FIFO queue
 uint8_t uart0_fifo_available() {
@@ -27,4 +27,125 @@ const uint8_t dither_steps[8] = {
 };
 
 // Decides what the current dither threshold from above is used
-uint8_t dither_index = 0;
\ No newline at end of file
+uint8_t dither_index = 0;
+
+// #############################################################################################
+// Adaptive dithering
+//
+// The fixed mode above always cycles through the 8 dither_steps, recovering ~3 extra bits of
+// color resolution. The adaptive mode instead uses a cycle of 8-64 phases (3-6 extra bits),
+// choosing the longest cycle that still keeps the flicker of a single dither step above
+// dither_min_flicker_hz at the measured frame rate. Phases are visited in bit-reversed order so
+// that "on" frames are spread as evenly as possible through the cycle, and each pixel starts at
+// its own phase offset (below) instead of using the two-field checkerboard.
+
+#define DITHER_MIN_CYCLE_BITS 3  // 8 phases, same as the fixed mode
+#define DITHER_MAX_CYCLE_BITS 6  // 64 phases
+
+// Per-pixel phase offsets from the R2 low-discrepancy sequence, giving a blue-noise-like
+// spatial distribution of the dither phases across the display
+const uint8_t dither_offset[7][16] = {
+  {  0, 36,  8, 45, 17, 54, 26, 63, 35,  8, 44, 17, 53, 26, 62, 35 },
+  { 48, 20, 57, 29,  2, 38, 11, 47, 20, 56, 29,  1, 37, 10, 46, 19 },
+  { 32,  5, 41, 14, 50, 22, 59, 31,  4, 40, 13, 49, 22, 58, 31,  3 },
+  { 16, 53, 25, 62, 34,  7, 43, 16, 52, 25, 61, 34,  6, 43, 15, 51 },
+  {  1, 37, 10, 46, 19, 55, 28,  0, 37,  9, 45, 18, 54, 27, 63, 36 },
+  { 49, 22, 58, 30,  3, 39, 12, 48, 21, 57, 30,  2, 39, 11, 48, 20 },
+  { 33,  6, 42, 15, 51, 24, 60, 33,  5, 42, 14, 51, 23, 59, 32,  4 },
+};
+
+// 6-bit bit reversal, used to order the dither thresholds within a cycle
+const uint8_t dither_bit_reverse[64] = {
+  0, 32, 16, 48,  8, 40, 24, 56,  4, 36, 20, 52, 12, 44, 28, 60,
+  2, 34, 18, 50, 10, 42, 26, 58,  6, 38, 22, 54, 14, 46, 30, 62,
+  1, 33, 17, 49,  9, 41, 25, 57,  5, 37, 21, 53, 13, 45, 29, 61,
+  3, 35, 19, 51, 11, 43, 27, 59,  7, 39, 23, 55, 15, 47, 31, 63
+};
+
+// Only ever touched by the GPU core, the CPU core stages new settings in RENDER_STATE_STAGED
+// (render_state.h)
+uint8_t dither_mode = DITHER_FIXED;
+uint8_t dither_min_flicker_hz = 100;
+
+// Thresholds for the current adaptive cycle, rebuilt whenever the cycle length changes
+uint8_t dither_thresholds[64];
+uint8_t dither_cycle_bits = DITHER_MIN_CYCLE_BITS;
+uint8_t dither_cycle_mask = (1 << DITHER_MIN_CYCLE_BITS) - 1;
+
+// Smoothed frame rate as measured by advance_dither()
+float dither_fps = 0.0;
+
+// #############################################################################################
+// Fill dither_thresholds[] for a cycle of 2^cycle_bits phases
+void build_dither_thresholds(uint8_t cycle_bits) {
+  uint8_t cycle_length = 1 << cycle_bits;
+
+  for (uint8_t phase = 0; phase < cycle_length; phase++) {
+    uint8_t reversed = dither_bit_reverse[phase] >> (DITHER_MAX_CYCLE_BITS - cycle_bits);
+    dither_thresholds[phase] = reversed << (8 - cycle_bits);
+  }
+
+  dither_cycle_bits = cycle_bits;
+  dither_cycle_mask = cycle_length - 1;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Pick the longest dither cycle whose slowest flicker component (fps / cycle length) stays
+// at or above dither_min_flicker_hz
+uint8_t select_dither_cycle_bits(float fps) {
+  uint8_t cycle_bits = DITHER_MIN_CYCLE_BITS;
+  float max_cycle_length = fps / dither_min_flicker_hz;
+
+  while (cycle_bits < DITHER_MAX_CYCLE_BITS && (1 << (cycle_bits + 1)) <= max_cycle_length) {
+    cycle_bits++;
+  }
+
+  return cycle_bits;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Called once per frame before quantizing, measures the frame rate and steps dither_index
+// through the current cycle. The adaptive cycle length is only changed when a cycle completes.
+void advance_dither(uint32_t t_now_us) {
+  static uint32_t t_last_us = 0;
+
+  uint32_t frame_us = t_now_us - t_last_us;
+  t_last_us = t_now_us;
+
+  if (frame_us > 0) {
+    dither_fps = dither_fps * 0.99 + (1000000.0 / frame_us) * 0.01;
+  }
+
+  dither_index += 1;
+
+  if (dither_mode == DITHER_ADAPTIVE) {
+    if (dither_index > dither_cycle_mask) {
+      dither_index = 0;
+
+      uint8_t cycle_bits = select_dither_cycle_bits(dither_fps);
+      if (cycle_bits != dither_cycle_bits) {
+        build_dither_thresholds(cycle_bits);
+      }
+    }
+  } else if (dither_index >= 8) {
+    dither_index = 0;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: switch between the fixed 8-step and adaptive dithering modes, called by
+// apply_render_state() so it never happens while update_leds() or advance_dither() is running
+void apply_dither_mode(uint8_t mode, uint8_t min_flicker_hz) {
+  dither_min_flicker_hz = min_flicker_hz;
+  dither_index = 0;
+  build_dither_thresholds(select_dither_cycle_bits(dither_fps));
+
+  dither_mode = mode;
+}
+// #############################################################################################
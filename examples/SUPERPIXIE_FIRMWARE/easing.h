@@ -0,0 +1,141 @@
+// #############################################################################################
+// Easing curves
+//
+// Every easing curve (see interpolation_types in constants.h) is compiled into a lookup table
+// of EASING_LUT_SIZE entries when the GPU core starts, and interpolate_curve() reads it with
+// linear interpolation instead of calling sqrt() every frame. Transitions, effects and anything
+// else animated share the same tables.
+//
+// The CUSTOM_CURVE_* slots start out linear, and can be replaced by the host with
+// COM_SET_EASING_CURVE, a curve of EASING_CUSTOM_POINTS evenly spaced points. The CPU core
+// queues the points through the render command ring (render_state.h), and the GPU core writes
+// them to easing_custom_points[][] and resamples the slot's table in update_easing_curves(),
+// which apply_render_state() calls before anything in the frame is animated.
+
+#define EASING_LUT_BITS 8
+#define EASING_LUT_SIZE ((1 << EASING_LUT_BITS) + 1)  // Extra entry so index + 1 never overflows
+
+#define EASING_CUSTOM_POINTS 64
+#define EASING_CUSTOM_POINTS_PER_PACKET 32  // A whole curve doesn't fit in one packet
+
+uint16_t easing_lut[NUM_INTERPOLATION_TYPES][EASING_LUT_SIZE];
+
+// Only ever touched by the GPU core
+uint8_t easing_custom_points[NUM_CUSTOM_CURVES][EASING_CUSTOM_POINTS];
+bool easing_custom_curve_changed[NUM_CUSTOM_CURVES];
+
+// #############################################################################################
+// Evaluate one of the built in curves for a single 0.0-1.0 input, only used to build the LUTs
+float easing_transfer(float input_linear, uint8_t interpolation_type) {
+  if (interpolation_type == LINEAR) {
+    return input_linear;
+  }
+  else if (interpolation_type == EASE_IN) {
+    return input_linear * input_linear;
+  }
+  else if (interpolation_type == EASE_OUT) {
+    return sqrt(input_linear);
+  }
+  else if (interpolation_type == EASE_IN_SOFT) {
+    return input_linear * input_linear * input_linear;
+  }
+  else if (interpolation_type == EASE_OUT_SOFT) {
+    return sqrt(sqrt(input_linear));
+  }
+  else if (interpolation_type == S_CURVE) {
+    float a_val = input_linear * input_linear;
+    float b_val = sqrt(input_linear);
+    return ((a_val * (1.0 - input_linear)) + (b_val * (input_linear)));
+  }
+  else if (interpolation_type == S_CURVE_SOFT) {
+    float a_val = input_linear * input_linear * input_linear;
+    float b_val = sqrt(sqrt(input_linear));
+    return ((a_val * (1.0 - input_linear)) + (b_val * (input_linear)));
+  }
+
+  return input_linear;  // Custom curves start out linear
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Build every curve's table, resetting the custom curves to linear
+void init_easing_curves() {
+  for (uint8_t curve = 0; curve < NUM_INTERPOLATION_TYPES; curve++) {
+    for (uint16_t i = 0; i < EASING_LUT_SIZE; i++) {
+      float output = clip_float(easing_transfer(i / float(EASING_LUT_SIZE - 1), curve));
+      easing_lut[curve][i] = output * 65535 + 0.5;
+    }
+  }
+
+  for (uint8_t slot = 0; slot < NUM_CUSTOM_CURVES; slot++) {
+    for (uint8_t i = 0; i < EASING_CUSTOM_POINTS; i++) {
+      easing_custom_points[slot][i] = (i * 255 + (EASING_CUSTOM_POINTS - 1) / 2) / (EASING_CUSTOM_POINTS - 1);
+    }
+    easing_custom_curve_changed[slot] = false;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: store (count) points of a custom curve starting at point (first_point), called by
+// apply_render_state() for points queued from a COM_SET_EASING_CURVE packet. The curve's table
+// is resampled by update_easing_curves() before the frame is drawn.
+void set_easing_curve_points(uint8_t slot, uint8_t first_point, uint8_t count, const uint8_t* points) {
+  if (slot >= NUM_CUSTOM_CURVES || first_point >= EASING_CUSTOM_POINTS) {
+    return;
+  }
+
+  if (count > EASING_CUSTOM_POINTS - first_point) {
+    count = EASING_CUSTOM_POINTS - first_point;
+  }
+
+  memcpy(&easing_custom_points[slot][first_point], points, count);
+  easing_custom_curve_changed[slot] = true;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: resample any custom curves that changed since the last frame into their tables
+void update_easing_curves() {
+  for (uint8_t slot = 0; slot < NUM_CUSTOM_CURVES; slot++) {
+    if (easing_custom_curve_changed[slot] == false) {
+      continue;
+    }
+    easing_custom_curve_changed[slot] = false;
+
+    uint16_t* lut = easing_lut[CUSTOM_CURVE_A + slot];
+    for (uint16_t i = 0; i < EASING_LUT_SIZE; i++) {
+      float position = i * float(EASING_CUSTOM_POINTS - 1) / (EASING_LUT_SIZE - 1);
+      uint8_t index = position;
+      if (index >= EASING_CUSTOM_POINTS - 1) {
+        index = EASING_CUSTOM_POINTS - 2;
+      }
+
+      float output = interpolate_float(easing_custom_points[slot][index], easing_custom_points[slot][index + 1], position - index) / 255.0;
+      lut[i] = output * 65535 + 0.5;
+    }
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Shape a 0.0-1.0 progress value with one of the interpolation_types
+float interpolate_curve(float input_linear, uint8_t interpolation_type) {
+  if (interpolation_type >= NUM_INTERPOLATION_TYPES) {
+    interpolation_type = LINEAR;
+  }
+
+  float position = clip_float(input_linear) * (EASING_LUT_SIZE - 1);
+  uint16_t index = position;
+  if (index >= EASING_LUT_SIZE - 1) {
+    return easing_lut[interpolation_type][EASING_LUT_SIZE - 1] / 65535.0;
+  }
+
+  const uint16_t* lut = easing_lut[interpolation_type];
+  return interpolate_float(lut[index], lut[index + 1], position - index) / 65535.0;
+}
+// #############################################################################################
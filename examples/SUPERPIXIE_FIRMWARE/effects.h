@@ -0,0 +1,236 @@
+// #############################################################################################
+// Effect pool
+//
+// Ripples, sweeps, sparkles and pulses all run from a fixed pool of EFFECT_POOL_SIZE slots, so
+// any number of them (up to the pool size) can overlap without allocating anything. Spawning
+// into a full pool replaces the effect closest to finishing.
+//
+// Every frame, prepare_effects_layer() interpolates each running effect's parameters once, then
+// renders all of them into effects_buffer[][] in a single pass over the display, which the
+// compositor adds on top of the characters.
+//
+// Effects can be spawned over the chain with COM_SPAWN_EFFECT, with a DELAY_MS so the host can
+// schedule them ahead of time, or stagger one across a whole chain in a single broadcast
+// packet.
+
+#define EFFECT_POOL_SIZE 8
+#define EFFECT_SPARKLE_STEP_MS 60  // How long each set of sparkles lasts before the next is picked
+
+struct effect_slot {
+  bool ACTIVE;
+  effect_parameters PARAMETERS;
+  uint32_t START_TIME_US;
+  uint32_t END_TIME_US;
+  uint16_t SEED;  // Picks which pixels an EFFECT_SPARKLE lights up
+};
+
+// An effect's parameters as of the current frame
+struct effect_frame {
+  uint8_t TYPE;
+  CRGBF COLOR;  // Premultiplied by the effect's opacity
+  float POSITION;
+  float WIDTH;
+  uint32_t SPARKLE_STEP;
+  float SPARKLE_FADE;
+  uint16_t SEED;
+};
+
+effect_slot effect_pool[EFFECT_POOL_SIZE];
+CRGBF effects_buffer[LEDS_X][LEDS_Y];
+
+uint16_t effect_seed = 0;
+uint32_t effects_spawned = 0;
+uint32_t effects_replaced = 0;  // Effects cut short by a full pool
+
+// #############################################################################################
+// Stop every effect
+void init_effects() {
+  for (uint8_t i = 0; i < EFFECT_POOL_SIZE; i++) {
+    effect_pool[i].ACTIVE = false;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Start a new effect, (parameters.DELAY_MS) from now
+void spawn_effect(const effect_parameters& parameters) {
+  if (parameters.TYPE >= NUM_EFFECT_TYPES) {
+    return;
+  }
+
+  // Take a free slot, or the one that would have finished soonest
+  int8_t slot = -1;
+  for (uint8_t i = 0; i < EFFECT_POOL_SIZE; i++) {
+    if (effect_pool[i].ACTIVE == false) {
+      slot = i;
+      break;
+    }
+
+    if (slot == -1 || int32_t(effect_pool[i].END_TIME_US - effect_pool[slot].END_TIME_US) < 0) {
+      slot = i;
+    }
+  }
+
+  if (effect_pool[slot].ACTIVE == true) {
+    effects_replaced++;
+  }
+
+  effect_slot& effect = effect_pool[slot];
+  effect.PARAMETERS = parameters;
+  effect.START_TIME_US = time_us_now + (parameters.DELAY_MS * 1000);
+  effect.END_TIME_US = effect.START_TIME_US + (parameters.DURATION_MS * 1000);
+  effect.SEED = effect_seed++;
+  effect.ACTIVE = true;
+
+  effects_spawned++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Start a ripple, kept for the boot animation and anything else that still spawns ripples by
+// their parameters
+void spawn_ripple(CRGBF r_color_start, CRGBF r_color_destination, uint8_t interpolation_type, uint16_t duration_ms, float r_position_start, float r_width_start, float r_opacity_start, float r_position_destination, float r_width_destination, float r_opacity_destination) {
+  effect_parameters parameters = {
+    EFFECT_RIPPLE,
+    interpolation_type,
+    r_color_start,
+    r_color_destination,
+    r_position_start,
+    r_position_destination,
+    r_width_start,
+    r_width_destination,
+    r_opacity_start,
+    r_opacity_destination,
+    duration_ms,
+    0,
+  };
+
+  spawn_effect(parameters);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Cheap integer hash, used to pick sparkling pixels without storing any per-pixel state
+inline uint16_t hash_effect_pixel(uint8_t x, uint8_t y, uint16_t seed, uint32_t step) {
+  uint32_t h = (x * 73856093u) ^ (y * 19349663u) ^ (seed * 83492791u) ^ (step * 2654435761u);
+  h ^= h >> 13;
+  h *= 0x5bd1e995u;
+  h ^= h >> 15;
+
+  return h & 0xFFFF;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Brightness (0.0-1.0) at (coordinate) of a band centered on (position)
+inline float get_band_brightness(float coordinate, float position, float width) {
+  float distance = fabs(coordinate - position);
+  if (distance >= width) {
+    return 0.0;
+  }
+
+  return 1.0 - (distance / width);  // (0.0 is farthest, 1.0 is closest)
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Compositor layer: every running effect in the pool, added on top of the display
+bool prepare_effects_layer(compositor_layer& layer) {
+  effect_frame frames[EFFECT_POOL_SIZE];
+  uint8_t num_frames = 0;
+
+  // Interpolate each effect once for this frame, retiring finished ones
+  for (uint8_t i = 0; i < EFFECT_POOL_SIZE; i++) {
+    effect_slot& effect = effect_pool[i];
+    if (effect.ACTIVE == false) {
+      continue;
+    }
+
+    if (int32_t(time_us_now - effect.END_TIME_US) > 0) {
+      effect.ACTIVE = false;  // Effect is complete
+      continue;
+    }
+
+    int32_t elapsed_us = int32_t(time_us_now - effect.START_TIME_US);
+    if (elapsed_us < 0) {
+      continue;  // Still waiting for its start time
+    }
+
+    const effect_parameters& parameters = effect.PARAMETERS;
+
+    float progress = 1.0;
+    if (parameters.DURATION_MS > 0) {
+      progress = elapsed_us / (parameters.DURATION_MS * 1000.0);
+    }
+    progress = interpolate_curve(progress, parameters.INTERPOLATION);
+
+    float opacity = interpolate_float(parameters.OPACITY_START, parameters.OPACITY_END, progress);
+    if (opacity <= 0.0) {
+      continue;
+    }
+
+    effect_frame& frame = frames[num_frames++];
+    frame.TYPE = parameters.TYPE;
+    frame.COLOR = interpolate_CRGBF(parameters.COLOR_START, parameters.COLOR_END, progress);
+    frame.COLOR.r *= opacity;
+    frame.COLOR.g *= opacity;
+    frame.COLOR.b *= opacity;
+    frame.POSITION = interpolate_float(parameters.POSITION_START, parameters.POSITION_END, progress);
+    frame.WIDTH = interpolate_float(parameters.WIDTH_START, parameters.WIDTH_END, progress);
+    frame.SPARKLE_STEP = (elapsed_us / 1000) / EFFECT_SPARKLE_STEP_MS;
+    frame.SPARKLE_FADE = 1.0 - float((elapsed_us / 1000) % EFFECT_SPARKLE_STEP_MS) / EFFECT_SPARKLE_STEP_MS;
+    frame.SEED = effect.SEED;
+  }
+
+  if (num_frames == 0) {
+    return false;
+  }
+
+  // Render every effect in one pass over the display
+  for (uint8_t x = 0; x < LEDS_X; x++) {
+    for (uint8_t y = 0; y < LEDS_Y; y++) {
+      CRGBF pixel = { 0.0, 0.0, 0.0 };
+
+      for (uint8_t i = 0; i < num_frames; i++) {
+        const effect_frame& frame = frames[i];
+
+        float brightness = 0.0;
+        if (frame.TYPE == EFFECT_RIPPLE) {
+          brightness = get_band_brightness(y, frame.POSITION, frame.WIDTH);
+        }
+        else if (frame.TYPE == EFFECT_SWEEP) {
+          brightness = get_band_brightness(x, frame.POSITION, frame.WIDTH);
+        }
+        else if (frame.TYPE == EFFECT_SPARKLE) {
+          if (hash_effect_pixel(x, y, frame.SEED, frame.SPARKLE_STEP) < frame.WIDTH * 65535.0) {
+            brightness = frame.SPARKLE_FADE;
+          }
+        }
+        else if (frame.TYPE == EFFECT_PULSE) {
+          brightness = 1.0;
+        }
+
+        if (brightness > 0.0) {
+          pixel.r = add_clipped_float(pixel.r, frame.COLOR.r * brightness);
+          pixel.g = add_clipped_float(pixel.g, frame.COLOR.g * brightness);
+          pixel.b = add_clipped_float(pixel.b, frame.COLOR.b * brightness);
+        }
+      }
+
+      effects_buffer[x][y] = pixel;
+    }
+  }
+
+  layer.DIRTY = true;
+  return true;
+}
+
+void effects_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  color = effects_buffer[x][y];
+}
+// #############################################################################################
@@ -0,0 +1,87 @@
+// The gamma lookup table maps a 16-bit linear value to a 16-bit output value. Storing all 65536
+// entries would cost 128KB of RAM, so the table is sampled every 2^GAMMA_LUT_FRACTION_BITS
+// input steps and linearly interpolated in between using only integer math.
+#define GAMMA_LUT_BITS 10
+#define GAMMA_LUT_FRACTION_BITS (16 - GAMMA_LUT_BITS)
+#define GAMMA_LUT_SIZE ((1 << GAMMA_LUT_BITS) + 1)  // Extra entry so index + 1 never overflows
+
+uint16_t gamma_lut[GAMMA_LUT_SIZE];
+
+// The curve gamma_lut[] was built from, see gamma_curves in constants.h. Only ever touched by
+// the GPU core, the CPU core stages new settings in RENDER_STATE_STAGED (render_state.h).
+uint8_t gamma_curve = GAMMA_SQUARE;  // Matches the original "cheap gamma" on boot
+float gamma_exponent = 2.0;          // Only used by GAMMA_POWER
+
+// #############################################################################################
+// Evaluate the selected transfer curve for a single 0.0-1.0 input, only used to build the LUT
+float gamma_transfer(float input) {
+  if (gamma_curve == GAMMA_LINEAR) {
+    return input;
+  } else if (gamma_curve == GAMMA_SQUARE) {
+    return input * input;
+  } else if (gamma_curve == GAMMA_POWER) {
+    return powf(input, gamma_exponent);
+  } else if (gamma_curve == GAMMA_SRGB) {
+    if (input <= 0.04045) {
+      return input / 12.92;
+    } else {
+      return powf((input + 0.055) / 1.055, 2.4);
+    }
+  }
+
+  return input;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Rebuild gamma_lut[] from the current curve settings
+void build_gamma_lut() {
+  for (uint16_t i = 0; i < GAMMA_LUT_SIZE; i++) {
+    float input = i / float(GAMMA_LUT_SIZE - 1);
+    float output = gamma_transfer(input);
+
+    if (output < 0.0) { output = 0.0; }
+    if (output > 1.0) { output = 1.0; }
+
+    gamma_lut[i] = output * 65535 + 0.5;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Scale a floating point color channel to a 16-bit linear value, clipping to the 0.0-1.0 range
+inline uint16_t float_to_linear_16(float input) {
+  if (input <= 0.0) { return 0; }
+  if (input >= 1.0) { return 65535; }
+
+  return input * 65535;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Apply the gamma curve to a 16-bit linear value through the lookup table
+inline uint16_t apply_gamma_16(uint16_t linear) {
+  uint16_t index = linear >> GAMMA_LUT_FRACTION_BITS;
+  uint16_t fraction = linear & ((1 << GAMMA_LUT_FRACTION_BITS) - 1);
+
+  int32_t a = gamma_lut[index];
+  int32_t b = gamma_lut[index + 1];
+
+  return a + (((b - a) * fraction) >> GAMMA_LUT_FRACTION_BITS);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: switch to a new curve, called by apply_render_state() between frames so the table
+// is never rebuilt while update_leds() is reading it
+void apply_gamma_curve(uint8_t curve, float exponent) {
+  gamma_curve = curve;
+  gamma_exponent = exponent;
+
+  build_gamma_lut();
+}
+// #############################################################################################
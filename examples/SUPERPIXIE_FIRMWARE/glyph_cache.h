@@ -0,0 +1,252 @@
+// #############################################################################################
+// Glyph cache
+//
+// The font tables in ascii.h live in flash, where every read goes through the ESP32's shared
+// flash cache. Displays like clocks cycle through the same handful of characters forever, so
+// glyphs in use are copied into RAM pools of GLYPH_CACHE_VERTICES vertices and GLYPH_CACHE_LINES
+// line segments and reused. Glyphs stay in the font's indexed format (shared vertices plus pairs
+// of vertex indices), so the rasterizer only has to transform each vertex once per frame. A hit
+// is just a lookup returning pointers into the pools, and when a pool or the entry table is full
+// the least recently used glyph is evicted to make room.
+//
+// A vertex costs sizeof(vec2D) (8 bytes) and a line sizeof(font_line) (2 bytes), so the default
+// budget is 8KB + 2KB. The largest glyphs in the font have FONT_MAX_GLYPH_VERTICES vertices and
+// FONT_MAX_GLYPH_LINES lines.
+
+#define GLYPH_CACHE_VERTICES 1024  // Memory budget, in vertices
+#define GLYPH_CACHE_LINES 1024     // Memory budget, in line segments
+#define GLYPH_CACHE_ENTRIES 32     // Maximum number of glyphs cached at once
+
+#define GLYPH_CACHE_NONE (-1)
+
+struct glyph_cache_entry {
+  char CHARACTER;         // 0 if this entry is unused
+  uint16_t VERTEX_START;  // Index of the glyph's first vertex in glyph_cache_vertices[]
+  uint16_t LINE_START;    // Index of the glyph's first line in glyph_cache_lines[]
+  uint8_t NUM_VERTICES;
+  uint8_t NUM_LINES;
+  vec2D BOUNDS_MIN;       // Bounding box of the glyph's vertices, for culling
+  vec2D BOUNDS_MAX;
+  uint32_t LAST_USED;     // Value of glyph_cache_clock when this glyph was last requested
+};
+
+// A cached glyph as seen by the rasterizer, line indices are relative to (vertices)
+struct glyph_mesh {
+  const vec2D* vertices;
+  const font_line* lines;
+  uint8_t num_vertices;
+  uint8_t num_lines;
+  vec2D bounds_min;
+  vec2D bounds_max;
+};
+
+vec2D glyph_cache_vertices[GLYPH_CACHE_VERTICES];
+font_line glyph_cache_lines[GLYPH_CACHE_LINES];
+glyph_cache_entry glyph_cache[GLYPH_CACHE_ENTRIES];
+
+// Glyphs are packed into both pools from the start, always in the same order
+uint16_t glyph_cache_used_vertices = 0;
+uint16_t glyph_cache_used_lines = 0;
+uint32_t glyph_cache_clock = 0;
+
+uint32_t glyph_cache_hits = 0;
+uint32_t glyph_cache_misses = 0;
+uint32_t glyph_cache_evictions = 0;
+
+// #############################################################################################
+// Find the glyph drawn for an ASCII character, or NULL for characters with nothing to draw
+const font_glyph* get_font_glyph(char c) {
+  if (c < FONT_FIRST_CHARACTER || c >= FONT_FIRST_CHARACTER + FONT_NUM_GLYPHS) {
+    return NULL;
+  }
+
+  return &font_glyphs[c - FONT_FIRST_CHARACTER];
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Empty the cache, invalidating every pointer it has handed out
+void init_glyph_cache() {
+  for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+    glyph_cache[i].CHARACTER = 0;
+  }
+
+  glyph_cache_used_vertices = 0;
+  glyph_cache_used_lines = 0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Slide every cached glyph down to the start of both pools, closing the gaps left by evictions.
+// Entries keep their index, but the pointers returned by get_glyph_mesh() change.
+void compact_glyph_cache() {
+  uint16_t vertex_cursor = 0;
+  uint16_t line_cursor = 0;
+
+  while (true) {
+    // Find the cached glyph that starts lowest in the pools, but at or above the cursor. Both
+    // pools are filled in the same order, so ordering by vertices orders the lines too.
+    int8_t next = GLYPH_CACHE_NONE;
+    for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+      if (glyph_cache[i].CHARACTER != 0 && glyph_cache[i].VERTEX_START >= vertex_cursor) {
+        if (next == GLYPH_CACHE_NONE || glyph_cache[i].VERTEX_START < glyph_cache[next].VERTEX_START) {
+          next = i;
+        }
+      }
+    }
+
+    if (next == GLYPH_CACHE_NONE) {
+      break;
+    }
+
+    glyph_cache_entry& entry = glyph_cache[next];
+
+    if (entry.VERTEX_START != vertex_cursor) {
+      memmove(&glyph_cache_vertices[vertex_cursor], &glyph_cache_vertices[entry.VERTEX_START], sizeof(vec2D) * entry.NUM_VERTICES);
+      entry.VERTEX_START = vertex_cursor;
+    }
+
+    if (entry.LINE_START != line_cursor) {
+      memmove(&glyph_cache_lines[line_cursor], &glyph_cache_lines[entry.LINE_START], sizeof(font_line) * entry.NUM_LINES);
+      entry.LINE_START = line_cursor;
+    }
+
+    vertex_cursor += entry.NUM_VERTICES;
+    line_cursor += entry.NUM_LINES;
+  }
+
+  glyph_cache_used_vertices = vertex_cursor;
+  glyph_cache_used_lines = line_cursor;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Bounding box of (num_vertices) glyph vertices, or a point at the origin when there are none
+void get_glyph_bounds(const vec2D* vertices, uint8_t num_vertices, vec2D& bounds_min, vec2D& bounds_max) {
+  bounds_min = { 0.0, 0.0 };
+  bounds_max = { 0.0, 0.0 };
+
+  for (uint8_t i = 0; i < num_vertices; i++) {
+    vec2D vertex = vertices[i];
+    if (i == 0) {
+      bounds_min = vertex;
+      bounds_max = vertex;
+    }
+
+    if (vertex.x < bounds_min.x) { bounds_min.x = vertex.x; }
+    if (vertex.y < bounds_min.y) { bounds_min.y = vertex.y; }
+    if (vertex.x > bounds_max.x) { bounds_max.x = vertex.x; }
+    if (vertex.y > bounds_max.y) { bounds_max.y = vertex.y; }
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Get the index of (character) in the cache, copying it out of flash on a miss. The entry at
+// index (pinned) is never evicted, since it's still being drawn. Returns GLYPH_CACHE_NONE for
+// characters with nothing to draw, or that can't fit in the budget.
+int8_t get_cached_glyph(char character, int8_t pinned) {
+  glyph_cache_clock++;
+
+  const font_glyph* glyph = get_font_glyph(character);
+  if (glyph == NULL) {
+    return GLYPH_CACHE_NONE;  // Draw nothing if character provided is out of the font's range
+  }
+
+  for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+    if (glyph_cache[i].CHARACTER == character) {
+      glyph_cache[i].LAST_USED = glyph_cache_clock;
+      glyph_cache_hits++;
+      return i;
+    }
+  }
+
+  glyph_cache_misses++;
+
+  uint16_t num_vertices = glyph->num_vertices;
+  uint16_t num_lines = glyph->num_lines;
+
+  // Evict least recently used glyphs until there's a free entry and enough room in both pools
+  while (true) {
+    int8_t free_entry = GLYPH_CACHE_NONE;
+    int8_t oldest_entry = GLYPH_CACHE_NONE;
+    uint16_t live_vertices = 0;
+    uint16_t live_lines = 0;
+
+    for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+      if (glyph_cache[i].CHARACTER == 0) {
+        if (free_entry == GLYPH_CACHE_NONE) {
+          free_entry = i;
+        }
+      } else {
+        live_vertices += glyph_cache[i].NUM_VERTICES;
+        live_lines += glyph_cache[i].NUM_LINES;
+
+        if (i != pinned) {
+          if (oldest_entry == GLYPH_CACHE_NONE || glyph_cache[i].LAST_USED < glyph_cache[oldest_entry].LAST_USED) {
+            oldest_entry = i;
+          }
+        }
+      }
+    }
+
+    bool fits = (live_vertices + num_vertices <= GLYPH_CACHE_VERTICES) && (live_lines + num_lines <= GLYPH_CACHE_LINES);
+
+    if (free_entry != GLYPH_CACHE_NONE && fits == true) {
+      if (glyph_cache_used_vertices + num_vertices > GLYPH_CACHE_VERTICES || glyph_cache_used_lines + num_lines > GLYPH_CACHE_LINES) {
+        compact_glyph_cache();
+      }
+
+      glyph_cache_entry& entry = glyph_cache[free_entry];
+      entry.CHARACTER = character;
+      entry.VERTEX_START = glyph_cache_used_vertices;
+      entry.LINE_START = glyph_cache_used_lines;
+      entry.NUM_VERTICES = num_vertices;
+      entry.NUM_LINES = num_lines;
+      entry.LAST_USED = glyph_cache_clock;
+
+      memcpy(&glyph_cache_vertices[entry.VERTEX_START], &font_vertices[glyph->first_vertex], sizeof(vec2D) * num_vertices);
+      memcpy(&glyph_cache_lines[entry.LINE_START], &font_lines[glyph->first_line], sizeof(font_line) * num_lines);
+
+      // Measure the glyph once here, so drawing can cull it without touching its lines
+      get_glyph_bounds(&glyph_cache_vertices[entry.VERTEX_START], num_vertices, entry.BOUNDS_MIN, entry.BOUNDS_MAX);
+
+      glyph_cache_used_vertices += num_vertices;
+      glyph_cache_used_lines += num_lines;
+
+      return free_entry;
+    }
+
+    if (oldest_entry == GLYPH_CACHE_NONE) {
+      return GLYPH_CACHE_NONE;  // Glyph is bigger than the whole budget
+    }
+
+    glyph_cache[oldest_entry].CHARACTER = 0;
+    glyph_cache_evictions++;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Get the vertices and lines of a cached glyph, or an empty mesh for GLYPH_CACHE_NONE. Only
+// valid until the next get_cached_glyph() call, which may move glyphs around in the pools.
+glyph_mesh get_glyph_mesh(int8_t entry) {
+  glyph_mesh mesh = { NULL, NULL, 0, 0, { 0.0, 0.0 }, { 0.0, 0.0 } };
+
+  if (entry != GLYPH_CACHE_NONE) {
+    mesh.vertices = &glyph_cache_vertices[glyph_cache[entry].VERTEX_START];
+    mesh.lines = &glyph_cache_lines[glyph_cache[entry].LINE_START];
+    mesh.num_vertices = glyph_cache[entry].NUM_VERTICES;
+    mesh.num_lines = glyph_cache[entry].NUM_LINES;
+    mesh.bounds_min = glyph_cache[entry].BOUNDS_MIN;
+    mesh.bounds_max = glyph_cache[entry].BOUNDS_MAX;
+  }
+
+  return mesh;
+}
+// #############################################################################################
@@ -0,0 +1,193 @@
+// #############################################################################################
+// Glyph distance fields
+//
+// The segment rasterizer in vector_drawing.h tests every pixel near every line of a glyph, every
+// frame, and a '0' alone has 27 lines. When GLYPH_RENDER_SDF is 1, each glyph is instead turned
+// into a distance field once, when it's loaded: a grid covering the font's bounding box at
+// GLYPH_SDF_RESOLUTION samples per LED, each holding the distance to the nearest line. Drawing
+// is then one bilinear lookup per pixel through the inverse of the character's transform.
+//
+// The field is sampled in glyph space, so under scaling the stroke is scaled back to one LED
+// wide by the transform's scale factor. That's exact for the uniform scaling and rotation used
+// by most transitions, but not once the axes are scaled differently (the flip transitions), or
+// the glyph is squashed so far that GLYPH_SDF_MAX_DISTANCE no longer covers the whole stroke.
+// Drawing falls back to the segment rasterizer in both cases.
+//
+// benchmark_glyph_rendering() in test_code.h measures both renderers and checks the difference
+// against GLYPH_SDF_MAX_ERROR and GLYPH_SDF_MEAN_ERROR. The native benchmark in extras/native
+// runs it, and fails when either is exceeded.
+//
+// At the default resolution a field is 38 x 70 samples of one byte each, about 2.6KB.
+
+#define GLYPH_SDF_RESOLUTION 4       // Samples per LED
+#define GLYPH_SDF_MAX_DISTANCE 1.5   // Glyph space distance stored as 255, anything further is clipped
+#define GLYPH_SDF_MARGIN GLYPH_SDF_MAX_DISTANCE  // Space kept around the font's bounding box
+#define GLYPH_SDF_MAX_ANISOTROPY 1.1  // Largest ratio between X and Y scale drawn from the field
+
+#define GLYPH_SDF_WIDTH (uint16_t((FONT_MAX_X - FONT_MIN_X + 2 * GLYPH_SDF_MARGIN) * GLYPH_SDF_RESOLUTION) + 2)
+#define GLYPH_SDF_HEIGHT (uint16_t((FONT_MAX_Y - FONT_MIN_Y + 2 * GLYPH_SDF_MARGIN) * GLYPH_SDF_RESOLUTION) + 2)
+
+// Glyph space position of SAMPLES[0][0]
+#define GLYPH_SDF_ORIGIN_X (FONT_MIN_X - GLYPH_SDF_MARGIN)
+#define GLYPH_SDF_ORIGIN_Y (FONT_MIN_Y - GLYPH_SDF_MARGIN)
+
+// Largest differences from the segment rasterizer accepted by benchmark_glyph_rendering()
+#define GLYPH_SDF_MAX_ERROR 0.25   // Any single pixel of the character mask
+#define GLYPH_SDF_MEAN_ERROR 0.01  // Averaged over every pixel drawn by either renderer
+
+struct glyph_distance_field {
+  char CHARACTER;   // Glyph this field was built from
+  bool HAS_LINES;   // False for characters with nothing to draw
+  uint8_t SAMPLES[GLYPH_SDF_WIDTH][GLYPH_SDF_HEIGHT];  // 0-255 maps to 0.0-GLYPH_SDF_MAX_DISTANCE
+};
+
+// #############################################################################################
+// Build the distance field of (mesh) into (field), only lines within GLYPH_SDF_MAX_DISTANCE of
+// a sample are tested against it
+void build_glyph_distance_field(const glyph_mesh& mesh, char character, glyph_distance_field& field) {
+  const float max_distance_squared = GLYPH_SDF_MAX_DISTANCE * GLYPH_SDF_MAX_DISTANCE;
+  const float sample_spacing = 1.0 / GLYPH_SDF_RESOLUTION;
+
+  field.CHARACTER = character;
+  field.HAS_LINES = (mesh.num_lines > 0);
+
+  memset(field.SAMPLES, 255, sizeof(field.SAMPLES));
+
+  for (uint8_t line = 0; line < mesh.num_lines; line++) {
+    float line_start_x = mesh.vertices[mesh.lines[line].start].x;
+    float line_start_y = mesh.vertices[mesh.lines[line].start].y;
+    float line_end_x = mesh.vertices[mesh.lines[line].end].x;
+    float line_end_y = mesh.vertices[mesh.lines[line].end].y;
+
+    // Determine the range of samples this line can reach
+    float x_min = (line_start_x < line_end_x) ? line_start_x : line_end_x;
+    float x_max = (line_start_x > line_end_x) ? line_start_x : line_end_x;
+    float y_min = (line_start_y < line_end_y) ? line_start_y : line_end_y;
+    float y_max = (line_start_y > line_end_y) ? line_start_y : line_end_y;
+
+    int16_t sample_x_min = (x_min - GLYPH_SDF_MAX_DISTANCE - GLYPH_SDF_ORIGIN_X) * GLYPH_SDF_RESOLUTION;
+    int16_t sample_x_max = (x_max + GLYPH_SDF_MAX_DISTANCE - GLYPH_SDF_ORIGIN_X) * GLYPH_SDF_RESOLUTION + 1;
+    int16_t sample_y_min = (y_min - GLYPH_SDF_MAX_DISTANCE - GLYPH_SDF_ORIGIN_Y) * GLYPH_SDF_RESOLUTION;
+    int16_t sample_y_max = (y_max + GLYPH_SDF_MAX_DISTANCE - GLYPH_SDF_ORIGIN_Y) * GLYPH_SDF_RESOLUTION + 1;
+
+    if (sample_x_min < 0) { sample_x_min = 0; }
+    if (sample_y_min < 0) { sample_y_min = 0; }
+    if (sample_x_max > GLYPH_SDF_WIDTH - 1) { sample_x_max = GLYPH_SDF_WIDTH - 1; }
+    if (sample_y_max > GLYPH_SDF_HEIGHT - 1) { sample_y_max = GLYPH_SDF_HEIGHT - 1; }
+
+    for (int16_t x = sample_x_min; x <= sample_x_max; x++) {
+      for (int16_t y = sample_y_min; y <= sample_y_max; y++) {
+        float dist_squared = shortest_distance_to_segment(
+          GLYPH_SDF_ORIGIN_X + x * sample_spacing, GLYPH_SDF_ORIGIN_Y + y * sample_spacing,
+          line_start_x, line_start_y,
+          line_end_x, line_end_y);
+
+        if (dist_squared < max_distance_squared) {
+          uint8_t sample = sqrt(dist_squared) * (255.0 / GLYPH_SDF_MAX_DISTANCE) + 0.5;
+          if (sample < field.SAMPLES[x][y]) {
+            field.SAMPLES[x][y] = sample;
+          }
+        }
+      }
+    }
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Draw (field) to draw_mask[][] through (transform), matching the segment rasterizer's one LED
+// wide stroke and falloff. Returns false without drawing anything if the transform squashes or
+// stretches the glyph too far for the field to match the stroke, so the caller can rasterize it
+// instead.
+bool draw_glyph_distance_field(const glyph_distance_field& field, float draw_mask[LEDS_X][LEDS_Y], const transform_2D& transform, float opacity) {
+  const float line_segment_width = 1.0;
+  const float line_segment_width_squared = line_segment_width * line_segment_width;
+
+  if (field.HAS_LINES == false) {
+    return true;  // Nothing to draw
+  }
+
+  transform_2D inverse;
+  if (invert_transform_2D(transform, inverse) == false) {
+    return false;
+  }
+
+  // Distances only carry over from glyph space when both axes are scaled alike
+  float scale_x_squared = transform.m00 * transform.m00 + transform.m10 * transform.m10;
+  float scale_y_squared = transform.m01 * transform.m01 + transform.m11 * transform.m11;
+  const float max_anisotropy_squared = GLYPH_SDF_MAX_ANISOTROPY * GLYPH_SDF_MAX_ANISOTROPY;
+  if (scale_x_squared > scale_y_squared * max_anisotropy_squared || scale_y_squared > scale_x_squared * max_anisotropy_squared) {
+    return false;
+  }
+
+  // Glyph space distances are scaled into LED space by the transform's average scale factor
+  float stroke_scale = sqrt(fabs(transform.m00 * transform.m11 - transform.m01 * transform.m10));
+  if (stroke_scale * GLYPH_SDF_MAX_DISTANCE <= line_segment_width) {
+    return false;
+  }
+
+  float sample_to_distance = (GLYPH_SDF_MAX_DISTANCE / 255.0) * stroke_scale;
+
+  // Only visit the pixels the field can land on after transformation
+  const float corners[4][2] = {
+    { GLYPH_SDF_ORIGIN_X, GLYPH_SDF_ORIGIN_Y },
+    { GLYPH_SDF_ORIGIN_X + float(GLYPH_SDF_WIDTH - 1) / GLYPH_SDF_RESOLUTION, GLYPH_SDF_ORIGIN_Y },
+    { GLYPH_SDF_ORIGIN_X, GLYPH_SDF_ORIGIN_Y + float(GLYPH_SDF_HEIGHT - 1) / GLYPH_SDF_RESOLUTION },
+    { GLYPH_SDF_ORIGIN_X + float(GLYPH_SDF_WIDTH - 1) / GLYPH_SDF_RESOLUTION, GLYPH_SDF_ORIGIN_Y + float(GLYPH_SDF_HEIGHT - 1) / GLYPH_SDF_RESOLUTION },
+  };
+
+  float x_min = LEDS_X;
+  float x_max = -1;
+  float y_min = LEDS_Y;
+  float y_max = -1;
+  for (uint8_t i = 0; i < 4; i++) {
+    float x = transform.m00 * corners[i][0] + transform.m01 * corners[i][1] + transform.tx;
+    float y = transform.m10 * corners[i][0] + transform.m11 * corners[i][1] + transform.ty;
+
+    if (x < x_min) { x_min = x; }
+    if (x > x_max) { x_max = x; }
+    if (y < y_min) { y_min = y; }
+    if (y > y_max) { y_max = y; }
+  }
+
+  int16_t pixel_x_min = (x_min < 0) ? 0 : int16_t(x_min);
+  int16_t pixel_x_max = (x_max > LEDS_X - 1) ? LEDS_X - 1 : int16_t(x_max) + 1;
+  int16_t pixel_y_min = (y_min < 0) ? 0 : int16_t(y_min);
+  int16_t pixel_y_max = (y_max > LEDS_Y - 1) ? LEDS_Y - 1 : int16_t(y_max) + 1;
+
+  for (int16_t x = pixel_x_min; x <= pixel_x_max; x++) {
+    for (int16_t y = pixel_y_min; y <= pixel_y_max; y++) {
+      // Find where this pixel lands in the field
+      float sample_x = (inverse.m00 * x + inverse.m01 * y + inverse.tx - GLYPH_SDF_ORIGIN_X) * GLYPH_SDF_RESOLUTION;
+      float sample_y = (inverse.m10 * x + inverse.m11 * y + inverse.ty - GLYPH_SDF_ORIGIN_Y) * GLYPH_SDF_RESOLUTION;
+
+      if (sample_x < 0 || sample_y < 0 || sample_x >= GLYPH_SDF_WIDTH - 1 || sample_y >= GLYPH_SDF_HEIGHT - 1) {
+        continue;
+      }
+
+      uint16_t index_x = sample_x;
+      uint16_t index_y = sample_y;
+      float blend_x = sample_x - index_x;
+      float blend_y = sample_y - index_y;
+
+      float top = interpolate_float(field.SAMPLES[index_x][index_y], field.SAMPLES[index_x + 1][index_y], blend_x);
+      float bottom = interpolate_float(field.SAMPLES[index_x][index_y + 1], field.SAMPLES[index_x + 1][index_y + 1], blend_x);
+
+      float distance = interpolate_float(top, bottom, blend_y) * sample_to_distance;
+      float dist_squared = distance * distance;
+
+      if (dist_squared <= line_segment_width_squared) {
+        float brightness = (line_segment_width_squared - dist_squared);
+        brightness *= brightness;
+        brightness *= opacity;
+        if (brightness > draw_mask[x][y]) {
+          draw_mask[x][y] = brightness;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+// #############################################################################################
@@ -18,8 +18,14 @@ extern TaskHandle_t gpu_task;
 #define LEDS_Y 15
 
 // The image is arranged in memory in the same shape it's arranged in real life
-CRGBF leds[LEDS_X][NUM_LEDS_PER_STRIP];   // Floating point version  [7][16]
-CRGB leds_8[LEDS_X][NUM_LEDS_PER_STRIP];  // Quantized 8-bit version [7][16]
+CRGBF leds[LEDS_X][NUM_LEDS_PER_STRIP];  // Floating point version  [7][16]
+
+// The quantized 8-bit image is double-buffered: update_leds() renders into leds_8 while the
+// previous frame in leds_8_output is still being clocked out to the LEDs, and present_leds()
+// swaps the two once that output is done
+CRGB leds_8_buffers[2][LEDS_X][NUM_LEDS_PER_STRIP];
+CRGB (*leds_8)[NUM_LEDS_PER_STRIP] = leds_8_buffers[0];         // Quantized 8-bit version being rendered [7][16]
+CRGB (*leds_8_output)[NUM_LEDS_PER_STRIP] = leds_8_buffers[1];  // Quantized 8-bit version being shown    [7][16]
 
 CRGBF leds_blended[LEDS_X][NUM_LEDS_PER_STRIP];  // Output of frame blending
 CRGBF leds_last[LEDS_X][NUM_LEDS_PER_STRIP];     // Stores the last frame, used for frame blending
@@ -28,6 +34,19 @@ CRGBF leds_debug[LEDS_X][NUM_LEDS_PER_STRIP];  // Debugging LED mask
 
 CLEDController *controller[LEDS_X];  // One CLEDController object per lane
 
+#if LED_OUTPUT_PARALLEL == 1
+// leds_8 encoded as a single parallel bitstream for all lanes, see parallel_output.h. One buffer
+// is encoded into while the other is being clocked out by the I2S DMA.
+uint8_t leds_parallel[2][LED_PARALLEL_FRAME_BYTES(NUM_LEDS_PER_STRIP)] __attribute__((aligned(4)));
+uint8_t leds_parallel_index = 0;
+#else
+// Clocks leds_8_output out through the CLEDControllers, see loop_leds()
+TaskHandle_t led_task = NULL;
+
+// Given by loop_leds() when the last presented frame has been fully clocked out
+SemaphoreHandle_t led_output_done = NULL;
+#endif
+
 // These are the 7 GPIO pins of the LED highway
 const uint8_t led_pins[LEDS_X] = { 12, 14, 27, 26, 25, 33, 32 };
 
@@ -38,6 +57,22 @@ float debug_led_opacity = 0.0;
 // alternate vector characters, with both used during transitions
 float character_mask[2][LEDS_X][LEDS_Y];
 
+// Per-pixel display colors, rebuilt by update_display_color_map() only when the colors or
+// gradient type they were built from change. Each pixel's color is (base + mask * slope).
+CRGBF display_color_map[LEDS_X][LEDS_Y];
+CRGBF display_color_map_slope[LEDS_X][LEDS_Y];
+uint8_t display_color_map_type = GRADIENT_NONE;
+CRGBF display_color_map_a;
+CRGBF display_color_map_b;
+bool display_color_map_valid = false;
+uint32_t display_color_map_serial = 0;  // Incremented every time the map is rebuilt
+
+// Per-pixel background colors, rebuilt by prepare_background_layer() the same way
+CRGBF background_color_map[LEDS_X][LEDS_Y];
+CRGBF background_color_map_a;
+CRGBF background_color_map_b;
+bool background_color_map_valid = false;
+
 bool tx_flag_left = false;
 bool tx_flag_right = false;
 
@@ -50,26 +85,67 @@ bool here_flag = false;
 bool fade_in_complete = false;
 float GLOBAL_LED_BRIGHTNESS = 0.0;
 
-bool ripple_active = false;
-uint8_t ripple_interpolation = LINEAR;
+float touch_strength_smooth = 0.0;
+float touch_strength_smoother = 0.0;
+float touch_dimming = 1.0;
+
+
+#if LED_OUTPUT_PARALLEL == 0
+// #############################################################################################
+// LED output task: sends leds_8_output down all 7 lanes of the LED highway every time
+// present_leds() hands it a new frame
+void loop_leds(void *parameter) {
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    for (uint8_t x = 0; x < LEDS_X; x++) {
+      controller[x]->setLeds(leds_8_output[x], NUM_LEDS_PER_STRIP);
+      controller[x]->showLeds();
+    }
+
+    xSemaphoreGive(led_output_done);
+  }
+}
+// #############################################################################################
+#endif
+
 
-CRGBF ripple_color = { 1.0, 0.0, 0.0 };
-float ripple_position = 0.0;
-float ripple_width = 0.0;
-float ripple_opacity = 0.0;
+// #############################################################################################
+// Block until the last frame passed to present_leds() has been fully clocked out to the LEDs
+inline void wait_for_led_output() {
+#if LED_OUTPUT_PARALLEL == 1
+  wait_parallel_output();
+#else
+  xSemaphoreTake(led_output_done, portMAX_DELAY);
+  xSemaphoreGive(led_output_done);  // Only peeking, leave it available for present_leds()
+#endif
+}
+// #############################################################################################
 
-CRGBF ripple_color_start = { 1.0, 0.0, 0.0 };
-float ripple_position_start = 0.0;
-float ripple_width_start = 0.0;
-float ripple_opacity_start = 0.0;
 
-CRGBF ripple_color_destination = { 1.0, 0.0, 0.0 };
-float ripple_position_destination = 0.0;
-float ripple_width_destination = 0.0;
-float ripple_opacity_destination = 0.0;
+// #############################################################################################
+// Hand the freshly quantized leds_8 off to be clocked out, and return as soon as the previous
+// frame is done so the next one can be rendered while this one is being sent
+void present_leds() {
+#if LED_OUTPUT_PARALLEL == 1
+  // The I2S DMA is the output task here. The buffer being encoded into was last used two
+  // frames ago, and start_parallel_output() waits for the frame in flight before queueing.
+  encode_parallel_frame(leds_8[0], LEDS_X, NUM_LEDS_PER_STRIP, leds_parallel[leds_parallel_index]);
+  start_parallel_output(leds_parallel[leds_parallel_index], LED_PARALLEL_FRAME_BYTES(NUM_LEDS_PER_STRIP));
+  leds_parallel_index = !leds_parallel_index;
+#else
+  xSemaphoreTake(led_output_done, portMAX_DELAY);
+
+  // Swap the buffers, the frame just rendered becomes the one being shown
+  CRGB (*rendered)[NUM_LEDS_PER_STRIP] = leds_8;
+  leds_8 = leds_8_output;
+  leds_8_output = rendered;
+
+  xTaskNotifyGive(led_task);
+#endif
+}
+// #############################################################################################
 
-uint32_t ripple_start_time = 0;
-uint32_t ripple_end_time = 0;
 
 // #############################################################################################
 void init_leds() {
@@ -83,13 +159,19 @@ void init_leds() {
   // into seeing extra levels of color resolution than is normally posssible with 8-bit LEDs
   // like these, helping to preserve color resolution when the display is dimmed.
 
-  controller[0] = &FastLED.addLeds<WS2812B, 12, GRB>(leds_8[0], NUM_LEDS_PER_STRIP);
-  controller[1] = &FastLED.addLeds<WS2812B, 14, GRB>(leds_8[1], NUM_LEDS_PER_STRIP);
-  controller[2] = &FastLED.addLeds<WS2812B, 27, GRB>(leds_8[2], NUM_LEDS_PER_STRIP);
-  controller[3] = &FastLED.addLeds<WS2812B, 26, GRB>(leds_8[3], NUM_LEDS_PER_STRIP);
-  controller[4] = &FastLED.addLeds<WS2812B, 25, GRB>(leds_8[4], NUM_LEDS_PER_STRIP);
-  controller[5] = &FastLED.addLeds<WS2812B, 33, GRB>(leds_8[5], NUM_LEDS_PER_STRIP);
-  controller[6] = &FastLED.addLeds<WS2812B, 32, GRB>(leds_8[6], NUM_LEDS_PER_STRIP);
+  memset(leds_8_buffers, 0, sizeof(CRGB) * 2 * LEDS_X * NUM_LEDS_PER_STRIP);
+
+#if LED_OUTPUT_PARALLEL == 1
+  // All seven lanes are driven at once by the I2S peripheral instead, see parallel_output.h
+  init_parallel_output(led_pins, LEDS_X, LED_PARALLEL_FRAME_BYTES(NUM_LEDS_PER_STRIP));
+#else
+  controller[0] = &FastLED.addLeds<WS2812B, 12, GRB>(leds_8_output[0], NUM_LEDS_PER_STRIP);
+  controller[1] = &FastLED.addLeds<WS2812B, 14, GRB>(leds_8_output[1], NUM_LEDS_PER_STRIP);
+  controller[2] = &FastLED.addLeds<WS2812B, 27, GRB>(leds_8_output[2], NUM_LEDS_PER_STRIP);
+  controller[3] = &FastLED.addLeds<WS2812B, 26, GRB>(leds_8_output[3], NUM_LEDS_PER_STRIP);
+  controller[4] = &FastLED.addLeds<WS2812B, 25, GRB>(leds_8_output[4], NUM_LEDS_PER_STRIP);
+  controller[5] = &FastLED.addLeds<WS2812B, 33, GRB>(leds_8_output[5], NUM_LEDS_PER_STRIP);
+  controller[6] = &FastLED.addLeds<WS2812B, 32, GRB>(leds_8_output[6], NUM_LEDS_PER_STRIP);
 
   // -------------------------------------------------------------------------------------------
   // Don't worry FastLED, we'll do our own dithering
@@ -98,22 +180,30 @@ void init_leds() {
   FastLED.setDither(DISABLE_DITHER);
   // -------------------------------------------------------------------------------------------
 
-  memset(leds_8[0], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
-  memset(leds_8[1], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
-  memset(leds_8[2], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
-  memset(leds_8[3], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
-  memset(leds_8[4], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
-  memset(leds_8[5], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
-  memset(leds_8[6], 0, sizeof(CRGB) * NUM_LEDS_PER_STRIP);
+  // -------------------------------------------------------------------------------------------
+  // The LEDs are clocked out by their own task, pinned to core 1 alongside loop_gpu() (see
+  // init_cores()), so loop_gpu() can start rendering the next frame while the current one is
+  // still being sent. It runs at a higher priority than loop_gpu() so a presented frame is
+  // picked up immediately, but spends almost all of its time blocked waiting on FastLED's RMT
+  // interrupts, handing the core back. Keeping it off core 0 means it never preempts the UART
+  // parsing in loop_cpu().
+  led_output_done = xSemaphoreCreateBinary();
+  xSemaphoreGive(led_output_done);  // Nothing is being sent yet
+
+  xTaskCreatePinnedToCore(
+    loop_leds,     // Task function
+    "Loop (LEDs)", // Task name
+    4000,          // Stack size
+    NULL,          // Task parameter
+    2,             // Priority
+    &led_task,     // Task handle
+    1              // Same core as loop_gpu()
+  );
+  // -------------------------------------------------------------------------------------------
+#endif
 
   // Send black image to LEDs on boot
-  controller[0]->showLeds();
-  controller[1]->showLeds();
-  controller[2]->showLeds();
-  controller[3]->showLeds();
-  controller[4]->showLeds();
-  controller[5]->showLeds();
-  controller[6]->showLeds();
+  present_leds();
 }
 // #############################################################################################
 
@@ -186,51 +276,41 @@ struct CRGBF hsv(float h, float s, float v) {
 
 
 // #############################################################################################
-// ---------------------------------------------------------------------------------------------
-// Allows for blending of frames to simulate motion blur or phosphor decay
-inline void apply_frame_blending() {
+// Dims the composited image by the global brightness level into leds_blended[][], blending it
+// with the last frame to simulate motion blur or phosphor decay, all in one pass. leds[][] is
+// left untouched, so the compositor can reuse it on frames where none of its layers changed.
+inline void apply_brightness_and_frame_blending() {
+  float brightness = SYSTEM_STATE.BRIGHTNESS * GLOBAL_LED_BRIGHTNESS;
   float blend_val = frame_blending_amount;
 
-  if (blend_val > 0.0) {
-    // -------------------------------------------------------------------------------------------
-    // Iterate over entire matrix
-    for (uint8_t y = 0; y < LEDS_Y + 1; y++) {  // Extra row for backlight
-      for (uint8_t x = 0; x < LEDS_X; x++) {
+  // -------------------------------------------------------------------------------------------
+  // Iterate over entire matrix
+  for (uint8_t y = 0; y < LEDS_Y + 1; y++) {  // Extra row for backlight
+    for (uint8_t x = 0; x < LEDS_X; x++) {
+      CRGBF color = leds[x][y];
+
+      // The backlight already has its own brightness applied by draw_backlight()
+      if (y < LEDS_Y) {
+        color.r *= brightness;
+        color.g *= brightness;
+        color.b *= brightness;
+      }
+
+      if (blend_val > 0.0) {
         float decayed_r = leds_last[x][y].r * blend_val;
         float decayed_g = leds_last[x][y].g * blend_val;
         float decayed_b = leds_last[x][y].b * blend_val;
 
-        leds_blended[x][y].r = leds[x][y].r;
-        leds_blended[x][y].g = leds[x][y].g;
-        leds_blended[x][y].b = leds[x][y].b;
-
-        if (decayed_r > leds[x][y].r) { leds_blended[x][y].r = decayed_r; }
-        if (decayed_g > leds[x][y].g) { leds_blended[x][y].g = decayed_g; }
-        if (decayed_b > leds[x][y].b) { leds_blended[x][y].b = decayed_b; }
+        if (decayed_r > color.r) { color.r = decayed_r; }
+        if (decayed_g > color.g) { color.g = decayed_g; }
+        if (decayed_b > color.b) { color.b = decayed_b; }
       }
-    }
-    // -------------------------------------------------------------------------------------------
-  } else {
-    memcpy(leds_blended, leds, sizeof(CRGBF) * LEDS_X * NUM_LEDS_PER_STRIP);
-  }
-
-  memcpy(leds_last, leds_blended, sizeof(CRGBF) * LEDS_X * NUM_LEDS_PER_STRIP);
-}
-// #############################################################################################
-
 
-// #############################################################################################
-// Dims the input image by the global brightness level
-inline void apply_brightness() {
-  // -------------------------------------------------------------------------------------------
-  // Iterate over entire matrix
-  for (uint8_t y = 0; y < LEDS_Y; y++) {
-    for (uint8_t x = 0; x < LEDS_X; x++) {
-      leds[x][y].r *= SYSTEM_STATE.BRIGHTNESS * GLOBAL_LED_BRIGHTNESS;
-      leds[x][y].g *= SYSTEM_STATE.BRIGHTNESS * GLOBAL_LED_BRIGHTNESS;
-      leds[x][y].b *= SYSTEM_STATE.BRIGHTNESS * GLOBAL_LED_BRIGHTNESS;
+      leds_blended[x][y] = color;
+      leds_last[x][y] = color;
     }
   }
+  // -------------------------------------------------------------------------------------------
 }
 // #############################################################################################
 
@@ -246,12 +326,16 @@ inline void update_leds() {
 
   // -------------------------------------------------------------------------------------------
   // Increment the dither_index, which decides how the pixels are strategically flickered
-  // There are two fields in a checkerboard pattern, with two different indexes 180deg apart
-  dither_index += 1;
-  if (dither_index >= 8) {
-    dither_index = 0;
-  }
-  uint8_t dither_index_b = dither_index + 4;
+  // In the fixed mode there are two fields in a checkerboard pattern, with two different indexes
+  // 180deg apart. The adaptive mode gives every pixel its own phase offset instead.
+  advance_dither(time_us_now);
+
+  // Read once, so every pixel of the frame is quantized against the same phase
+  uint8_t mode = dither_mode;
+  uint8_t index = dither_index;
+  uint8_t cycle_mask = dither_cycle_mask;
+
+  uint8_t dither_index_b = index + 4;
   if (dither_index_b >= 8) {
     dither_index_b -= 8;
   }
@@ -261,13 +345,9 @@ inline void update_leds() {
   // Iterate over entire matrix
   for (uint8_t y = 0; y < LEDS_Y + 1; y++) {  // Extra row for backlight
     for (uint8_t x = 0; x < LEDS_X; x++) {
-      float gamma_r = leds_blended[x][y].r * leds_blended[x][y].r;  // Cheap gamma correction
-      float gamma_g = leds_blended[x][y].g * leds_blended[x][y].g;
-      float gamma_b = leds_blended[x][y].b * leds_blended[x][y].b;
-
-      uint16_t color_r_16 = gamma_r * 65535;  // Scale from floating point to 16-bit
-      uint16_t color_g_16 = gamma_g * 65535;
-      uint16_t color_b_16 = gamma_b * 65535;
+      uint16_t color_r_16 = apply_gamma_16(float_to_linear_16(leds_blended[x][y].r));  // Gamma correction via gamma_lut[]
+      uint16_t color_g_16 = apply_gamma_16(float_to_linear_16(leds_blended[x][y].g));
+      uint16_t color_b_16 = apply_gamma_16(float_to_linear_16(leds_blended[x][y].b));
 
       uint8_t color_r_8 = color_r_16 >> 8;  // Upper 8 bits of color
       uint8_t color_g_8 = color_g_16 >> 8;
@@ -281,19 +361,26 @@ inline void update_leds() {
       if (color_g_8 > 254) { color_g_8 = 254; }
       if (color_b_8 > 254) { color_b_8 = 254; }
 
-      uint8_t dither_bit = bitRead(dither_pattern[iter % 2][y], x);  // Get the checkerboard pattern
-      uint8_t dither_step_now = dither_index;
-      if (dither_bit == 1) {  // Decide which of the two dither indices to use based on the pattern
-        dither_step_now = dither_index_b;
+      uint8_t dither_threshold = 0;
+      if (mode == DITHER_ADAPTIVE) {
+        // Offset this pixel's phase within the current cycle
+        dither_threshold = dither_thresholds[(index + dither_offset[x][y]) & cycle_mask];
+      } else {
+        uint8_t dither_bit = bitRead(dither_pattern[iter % 2][y], x);  // Get the checkerboard pattern
+        uint8_t dither_step_now = index;
+        if (dither_bit == 1) {  // Decide which of the two dither indices to use based on the pattern
+          dither_step_now = dither_index_b;
+        }
+        dither_threshold = dither_steps[dither_step_now];
       }
 
-      // Set the dither bit according to the index vs. the lower 8 bits of the color
+      // Set the dither bit according to the threshold vs. the lower 8 bits of the color
       uint8_t dither_bit_r = 0;
       uint8_t dither_bit_g = 0;
       uint8_t dither_bit_b = 0;
-      if (color_r_dither > dither_steps[dither_step_now]) { dither_bit_r = 1; }
-      if (color_g_dither > dither_steps[dither_step_now]) { dither_bit_g = 1; }
-      if (color_b_dither > dither_steps[dither_step_now]) { dither_bit_b = 1; }
+      if (color_r_dither > dither_threshold) { dither_bit_r = 1; }
+      if (color_g_dither > dither_threshold) { dither_bit_g = 1; }
+      if (color_b_dither > dither_threshold) { dither_bit_b = 1; }
 
       // Assign quantized 8-bit data to the LED
       leds_8[x][y] = CRGB(color_r_8 + dither_bit_r, color_g_8 + dither_bit_g, color_b_8 + dither_bit_b);
@@ -301,14 +388,8 @@ inline void update_leds() {
   }
   // -------------------------------------------------------------------------------------------
 
-  // Send final dithered 8-bit image to LEDs
-  controller[0]->showLeds();
-  controller[1]->showLeds();
-  controller[2]->showLeds();
-  controller[3]->showLeds();
-  controller[4]->showLeds();
-  controller[5]->showLeds();
-  controller[6]->showLeds();
+  // Send final dithered 8-bit image to LEDs, overlapping with the rendering of the next frame
+  present_leds();
 }
 // #############################################################################################
 
@@ -323,28 +404,6 @@ void clear_leds() {
 // #############################################################################################
 
 
-// #############################################################################################
-// Mark the CPU cycles elapsed between now and the last
-// call to this function, to calculate the current FPS
-void watch_fps() {
-  static uint8_t iter = 0;
-  static uint32_t cycles_last = 0;
-  uint32_t cycles_now = ESP.getCycleCount();
-
-  uint32_t cycles_elapsed = cycles_now - cycles_last;
-
-  iter++;
-  if (iter % 10 == 0) {
-    float FPS = float(F_CPU) / cycles_elapsed;
-    Serial.println(FPS, 3);
-  }
-
-  cycles_last = cycles_now;
-  // -------------------------------------------------------------------------------------------
-}
-// #############################################################################################
-
-
 // #############################################################################################
 // Get the free heap and occasionally print it
 void watch_heap() {
@@ -376,54 +435,51 @@ void watch_stack() {
 // #############################################################################################
 
 
-CRGBF get_gradient_color(uint8_t x, uint8_t y, float draw_mask[LEDS_X][LEDS_Y]) {
+// #############################################################################################
+// Rebuild display_color_map[][] if the display colors or gradient type have changed since it was
+// last built, which outside of transitions is almost never
+void update_display_color_map() {
   uint8_t gradient_type = SYSTEM_STATE_INTERNAL[!current_system_state].DISPLAY_GRADIENT_TYPE;
-  CRGBF out_color = { 0.0, 0.0, 0.0 };
-
-  if (gradient_type == GRADIENT_NONE) {
-    out_color = SYSTEM_STATE.DISPLAY_COLOR_A;
-  } else if (gradient_type == GRADIENT_VERTICAL) {
-    float mix = y / float(LEDS_Y - 1);
-    out_color.r = SYSTEM_STATE.DISPLAY_COLOR_A.r * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.r * (1.0 - mix);
-    out_color.g = SYSTEM_STATE.DISPLAY_COLOR_A.g * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.g * (1.0 - mix);
-    out_color.b = SYSTEM_STATE.DISPLAY_COLOR_A.b * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.b * (1.0 - mix);
-  } else if (gradient_type == GRADIENT_VERTICAL_MIRRORED) {
-    float mix = saw_to_tri(y / float(LEDS_Y - 1));
-    out_color.r = SYSTEM_STATE.DISPLAY_COLOR_A.r * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.r * (1.0 - mix);
-    out_color.g = SYSTEM_STATE.DISPLAY_COLOR_A.g * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.g * (1.0 - mix);
-    out_color.b = SYSTEM_STATE.DISPLAY_COLOR_A.b * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.b * (1.0 - mix);
-  } else if (gradient_type == GRADIENT_HORIZONTAL) {
-    float mix = x / float(LEDS_X - 1);
-    out_color.r = SYSTEM_STATE.DISPLAY_COLOR_A.r * (1.0 - mix) + SYSTEM_STATE.DISPLAY_COLOR_B.r * (mix);
-    out_color.g = SYSTEM_STATE.DISPLAY_COLOR_A.g * (1.0 - mix) + SYSTEM_STATE.DISPLAY_COLOR_B.g * (mix);
-    out_color.b = SYSTEM_STATE.DISPLAY_COLOR_A.b * (1.0 - mix) + SYSTEM_STATE.DISPLAY_COLOR_B.b * (mix);
-  } else if (gradient_type == GRADIENT_HORIZONTAL_MIRRORED) {
-    float mix = saw_to_tri(x / float(LEDS_X - 1));
-    out_color.r = SYSTEM_STATE.DISPLAY_COLOR_A.r * (1.0 - mix) + SYSTEM_STATE.DISPLAY_COLOR_B.r * (mix);
-    out_color.g = SYSTEM_STATE.DISPLAY_COLOR_A.g * (1.0 - mix) + SYSTEM_STATE.DISPLAY_COLOR_B.g * (mix);
-    out_color.b = SYSTEM_STATE.DISPLAY_COLOR_A.b * (1.0 - mix) + SYSTEM_STATE.DISPLAY_COLOR_B.b * (mix);
-  } else if (gradient_type == GRADIENT_BRIGHTNESS) {
-    float mix = draw_mask[x][y];
-    out_color.r = SYSTEM_STATE.DISPLAY_COLOR_A.r * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.r * (1.0 - mix);
-    out_color.g = SYSTEM_STATE.DISPLAY_COLOR_A.g * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.g * (1.0 - mix);
-    out_color.b = SYSTEM_STATE.DISPLAY_COLOR_A.b * (mix) + SYSTEM_STATE.DISPLAY_COLOR_B.b * (1.0 - mix);
-  }
-
-  return out_color;
-}
+  CRGBF color_a = SYSTEM_STATE.DISPLAY_COLOR_A;
+  CRGBF color_b = SYSTEM_STATE.DISPLAY_COLOR_B;
 
+  if (display_color_map_valid == true && gradient_type == display_color_map_type && memcmp(&color_a, &display_color_map_a, sizeof(CRGBF)) == 0 && memcmp(&color_b, &display_color_map_b, sizeof(CRGBF)) == 0) {
+    return;
+  }
 
-// #############################################################################################
-// Converts a monochromatic character mask to an RGB image using solid colors or gradients
-void draw_mask_to_leds(float draw_mask[LEDS_X][LEDS_Y]) {
   for (uint8_t x = 0; x < LEDS_X; x++) {
     for (uint8_t y = 0; y < LEDS_Y; y++) {
-      CRGBF col_here = get_gradient_color(x, y, draw_mask);
-      leds[x][y].r = add_clipped_float(leds[x][y].r, draw_mask[x][y] * col_here.r);
-      leds[x][y].g = add_clipped_float(leds[x][y].g, draw_mask[x][y] * col_here.g);
-      leds[x][y].b = add_clipped_float(leds[x][y].b, draw_mask[x][y] * col_here.b);
+      CRGBF base = { 0.0, 0.0, 0.0 };
+      CRGBF slope = { 0.0, 0.0, 0.0 };
+
+      if (gradient_type == GRADIENT_NONE) {
+        base = color_a;
+      } else if (gradient_type == GRADIENT_VERTICAL) {
+        base = interpolate_CRGBF(color_b, color_a, y / float(LEDS_Y - 1));
+      } else if (gradient_type == GRADIENT_VERTICAL_MIRRORED) {
+        base = interpolate_CRGBF(color_b, color_a, saw_to_tri(y / float(LEDS_Y - 1)));
+      } else if (gradient_type == GRADIENT_HORIZONTAL) {
+        base = interpolate_CRGBF(color_a, color_b, x / float(LEDS_X - 1));
+      } else if (gradient_type == GRADIENT_HORIZONTAL_MIRRORED) {
+        base = interpolate_CRGBF(color_a, color_b, saw_to_tri(x / float(LEDS_X - 1)));
+      } else if (gradient_type == GRADIENT_BRIGHTNESS) {
+        // Blends from B to A as the mask brightens
+        base = color_b;
+        slope.r = color_a.r - color_b.r;
+        slope.g = color_a.g - color_b.g;
+        slope.b = color_a.b - color_b.b;
+      }
+
+      display_color_map[x][y] = base;
+      display_color_map_slope[x][y] = slope;
     }
   }
+
+  display_color_map_type = gradient_type;
+  display_color_map_a = color_a;
+  display_color_map_b = color_b;
+  display_color_map_valid = true;
+  display_color_map_serial++;
 }
 // #############################################################################################
 
@@ -431,9 +487,9 @@ void draw_mask_to_leds(float draw_mask[LEDS_X][LEDS_Y]) {
 // #############################################################################################
 // Set the color of text/icons on the screen
 void set_display_color(CRGBF color_a, CRGBF color_b) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].DISPLAY_COLOR_A = color_a;
-  SYSTEM_STATE_INTERNAL[!current_system_state].DISPLAY_COLOR_B = color_b;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.DISPLAY_COLOR_A = color_a;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.DISPLAY_COLOR_B = color_b;
+  stage_system_state_change();
 }
 
 void set_display_color(CRGBF color) {
@@ -445,17 +501,17 @@ void set_display_color(CRGBF color) {
 // #############################################################################################
 // Set the type of gradient used for drawing characters
 void set_gradient_type(uint8_t type) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].DISPLAY_GRADIENT_TYPE = type;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.DISPLAY_GRADIENT_TYPE = type;
+  stage_system_state_change();
 }
 
 
 // #############################################################################################
 // Set the color of the background
 void set_display_background_color(CRGBF color_a, CRGBF color_b) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].DISPLAY_BACKGROUND_COLOR_A = color_a;
-  SYSTEM_STATE_INTERNAL[!current_system_state].DISPLAY_BACKGROUND_COLOR_B = color_b;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.DISPLAY_BACKGROUND_COLOR_A = color_a;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.DISPLAY_BACKGROUND_COLOR_B = color_b;
+  stage_system_state_change();
 }
 
 void set_display_background_color(CRGBF color) {
@@ -467,16 +523,16 @@ void set_display_background_color(CRGBF color) {
 // #############################################################################################
 // Set the color of the backlight
 void set_backlight_color(CRGBF color) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].BACKLIGHT_COLOR = color;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.BACKLIGHT_COLOR = color;
+  stage_system_state_change();
 }
 // #############################################################################################
 
 // #############################################################################################
 // Sets the backlight brightness independently of the display
 void set_backlight_brightness(float brightness_value) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].BACKLIGHT_BRIGHTNESS = brightness_value;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.BACKLIGHT_BRIGHTNESS = brightness_value;
+  stage_system_state_change();
 }
 // #############################################################################################
 
@@ -484,8 +540,8 @@ void set_backlight_brightness(float brightness_value) {
 // #############################################################################################
 // Set the brightness of the screen
 void set_brightness(float brightness_value) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].BRIGHTNESS = brightness_value;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.BRIGHTNESS = brightness_value;
+  stage_system_state_change();
 }
 // #############################################################################################
 
@@ -501,36 +557,43 @@ void draw_backlight() {
 
 
 // #############################################################################################
-// Draws the background color/gradient to the LED image during frame updates
-void draw_background_gradient() {
-  for (uint8_t y = 0; y < LEDS_Y; y++) {
+// Compositor layer: the background color/gradient. The map is only rebuilt when the background
+// colors have changed since it was last built.
+bool prepare_background_layer(compositor_layer& layer) {
+  CRGBF color_a = SYSTEM_STATE.DISPLAY_BACKGROUND_COLOR_A;
+  CRGBF color_b = SYSTEM_STATE.DISPLAY_BACKGROUND_COLOR_B;
+
+  if (background_color_map_valid == true && memcmp(&color_a, &background_color_map_a, sizeof(CRGBF)) == 0 && memcmp(&color_b, &background_color_map_b, sizeof(CRGBF)) == 0) {
+    return true;
+  }
 
+  for (uint8_t y = 0; y < LEDS_Y; y++) {
     float blend_val = (y / float(LEDS_Y - 1));
 
-    CRGBF row_color = interpolate_CRGBF(SYSTEM_STATE.DISPLAY_BACKGROUND_COLOR_A, SYSTEM_STATE.DISPLAY_BACKGROUND_COLOR_B, blend_val);
+    CRGBF row_color = interpolate_CRGBF(color_a, color_b, blend_val);
 
-    if (y == 0 || y == LEDS_Y - 1) {
-      leds[0][y].r = row_color.r * 0.5;
-      leds[0][y].g = row_color.g * 0.5;
-      leds[0][y].b = row_color.b * 0.5;
-    } else {
-      leds[0][y] = row_color;
+    for (uint8_t x = 0; x < LEDS_X; x++) {
+      background_color_map[x][y] = row_color;
     }
 
-    leds[1][y] = row_color;
-    leds[2][y] = row_color;
-    leds[3][y] = row_color;
-    leds[4][y] = row_color;
-    leds[5][y] = row_color;
-
+    // The corner LEDs are dimmed
     if (y == 0 || y == LEDS_Y - 1) {
-      leds[6][y].r = row_color.r * 0.5;
-      leds[6][y].g = row_color.g * 0.5;
-      leds[6][y].b = row_color.b * 0.5;
-    } else {
-      leds[6][y] = row_color;
+      CRGBF corner_color = { row_color.r * 0.5f, row_color.g * 0.5f, row_color.b * 0.5f };
+      background_color_map[0][y] = corner_color;
+      background_color_map[LEDS_X - 1][y] = corner_color;
     }
   }
+
+  background_color_map_a = color_a;
+  background_color_map_b = color_b;
+  background_color_map_valid = true;
+
+  layer.DIRTY = true;
+  return true;
+}
+
+void background_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  color = background_color_map[x][y];
 }
 // #############################################################################################
 
@@ -548,133 +611,62 @@ void fade_out_during_delay_ms(uint16_t del_time_ms) {
 }
 
 
-void run_ripple() {
-  float progress = (time_us_now - ripple_start_time) / float(ripple_end_time - ripple_start_time);
-  if (progress > 1.0) {
-    progress = 1.0;
+// #############################################################################################
+// Compositor layers: while SuperPixie is being touched, the display is desaturated and dimmed
+// (TOUCH_DESATURATE and TOUCH_DIM), then glows with TOUCH_COLOR from one end (TOUCH_GLOW).
+// prepare_touch_layer() runs first and does the smoothing for all three.
+bool prepare_touch_layer(compositor_layer& layer) {
+  if (time_ms_now < 500) {
+    return false;
   }
 
-  if (ripple_interpolation == LINEAR) {
-    // Nothing
-  } else if (ripple_interpolation == EASE_IN) {
-    progress *= progress;
-  } else if (ripple_interpolation == EASE_OUT) {
-    progress = sqrt(progress);
-  } else if (ripple_interpolation == EASE_IN_SOFT) {
-    progress *= progress;
-    progress *= progress;
-  } else if (ripple_interpolation == EASE_OUT_SOFT) {
-    progress = sqrt(progress);
-    progress = sqrt(progress);
-  }
+  float touch_strength = clip_float(1.0 - clip_float((SYSTEM_STATE.TOUCH_VALUE - STORAGE.TOUCH_LOW_LEVEL) / (STORAGE.TOUCH_HIGH_LEVEL - STORAGE.TOUCH_LOW_LEVEL)));
 
-  ripple_color = interpolate_CRGBF(ripple_color_start, ripple_color_destination, progress);
-  ripple_position = interpolate_float(ripple_position_start, ripple_position_destination, progress);
-  ripple_width = interpolate_float(ripple_width_start, ripple_width_destination, progress);
-  ripple_opacity = interpolate_float(ripple_opacity_start, ripple_opacity_destination, progress);
-}
+  touch_strength_smooth = touch_strength * 0.05 + touch_strength_smooth * 0.95;
+  touch_strength_smoother = touch_strength_smooth * 0.95 + touch_strength_smoother * 0.05;
 
-void draw_ripple() {
-  if (ripple_active == true) {
-    if (time_us_now <= ripple_end_time) {
-      run_ripple();
-
-      for (uint8_t y = 0; y < LEDS_Y; y++) {
-        float y_dist = fabs(y - ripple_position);
-        if (y_dist <= ripple_width) {
-          float proximity = 1.0 - (y_dist / ripple_width);  // (0.0 is farthest, 1.0 is closest)
-
-          CRGBF out_col = ripple_color;
-          float brightness = (proximity * ripple_opacity);
-          out_col.r *= brightness;
-          out_col.g *= brightness;
-          out_col.b *= brightness;
-
-          for (uint8_t x = 0; x < LEDS_X; x++) {
-            leds[x][y] = add_clipped_CRGBF(leds[x][y], out_col);
-          }
-        }
-      }
-    } else {
-      ripple_active = false;  // Move is complete
-    }
+  if (touch_strength_smooth <= 0.01) {
+    return false;
   }
-}
 
-void spawn_ripple(CRGBF r_color_start, CRGBF r_color_destination, uint8_t interpolation_type, uint16_t duration_ms, float r_position_start, float r_width_start, float r_opacity_start, float r_position_destination, float r_width_destination, float r_opacity_destination) {
-  ripple_active = true;
-  ripple_color_start = r_color_start;
-  ripple_color_destination = r_color_destination;
+  touch_dimming = (0.35 + 0.65 * (1.0 - touch_strength_smoother));
 
-  ripple_interpolation = interpolation_type;
+  // The backlight sits outside of the layers, so it's tinted directly
+  leds[3][15] = interpolate_CRGBF(leds[3][15], SYSTEM_STATE.TOUCH_COLOR, touch_strength_smoother);
 
-  ripple_position_start = r_position_start;
-  ripple_width_start = r_width_start;
-  ripple_opacity_start = r_opacity_start;
-  ripple_position_destination = r_position_destination;
-  ripple_width_destination = r_width_destination;
-  ripple_opacity_destination = r_opacity_destination;
+  layer.OPACITY = touch_strength_smoother;
+  layer.DIRTY = true;
+  return true;
+}
 
-  ripple_start_time = time_us_now;
-  ripple_end_time = ripple_start_time + (duration_ms * 1000);
+bool prepare_touch_dim_layer(compositor_layer& layer) {
+  // Shown along with the TOUCH_DESATURATE layer below it
+  return (time_ms_now >= 500 && touch_strength_smooth > 0.01);
 }
 
-void draw_touch() {
-  if (time_ms_now >= 500) {
-    static float touch_strength_smooth = 0.0;
-    static float touch_strength_smoother = 0.0;
-
-    float touch_strength = clip_float(1.0 - clip_float((SYSTEM_STATE.TOUCH_VALUE - STORAGE.TOUCH_LOW_LEVEL) / (STORAGE.TOUCH_HIGH_LEVEL - STORAGE.TOUCH_LOW_LEVEL)));
-
-    touch_strength_smooth = touch_strength * 0.05 + touch_strength_smooth * 0.95;
-    touch_strength_smoother = touch_strength_smooth * 0.95 + touch_strength_smoother * 0.05;
-
-    /*
-    debug("TOUCH: ");
-    debug(STORAGE.TOUCH_LOW_LEVEL);
-    debug(" / ");
-    debug(SYSTEM_STATE.TOUCH_VALUE);
-    debug(" / ");
-    debug(STORAGE.TOUCH_HIGH_LEVEL);
-    debug(" \t ");
-    debug(touch_strength);
-    debug(" \t ");
-    debug(touch_strength_smooth);
-    debug(" \t ");
-    debug(touch_strength_smoother);
-    debug(" \t ");
-    debugln(STORAGE.TOUCH_THRESHOLD);
-    */
-
-    if (touch_strength_smooth > 0.01) {
-      float dimming = (0.35 + 0.65 * (1.0 - touch_strength_smoother));
-
-      for (uint8_t y = 0; y < LEDS_Y; y++) {
-        for (uint8_t x = 0; x < LEDS_X; x++) {
-          leds[x][y] = desaturate(leds[x][y], touch_strength_smoother);
-          leds[x][y].r *= dimming;
-          leds[x][y].g *= dimming;
-          leds[x][y].b *= dimming;
-        }
-      }
+void touch_dim_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  color.r = touch_dimming;
+  color.g = touch_dimming;
+  color.b = touch_dimming;
+}
 
-      for (uint8_t y = 0; y < LEDS_Y; y++) {
-        float height = y / float(LEDS_Y - 1);
-        if (SYSTEM_STATE.TOUCH_GLOW_POSITION == BOTTOM) {
-          height = 1.0 - height;
-        }
+bool prepare_touch_glow_layer(compositor_layer& layer) {
+  layer.OPACITY = touch_strength_smoother;
+  return (time_ms_now >= 500 && touch_strength_smooth > 0.01);
+}
 
-        height *= height;
-        height *= height;
-        height *= height;
-        height *= height;
+void touch_glow_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  float height = y / float(LEDS_Y - 1);
+  if (SYSTEM_STATE.TOUCH_GLOW_POSITION == BOTTOM) {
+    height = 1.0 - height;
+  }
 
-        for (uint8_t x = 0; x < LEDS_X; x++) {
-          leds[x][y] = interpolate_CRGBF(leds[x][y], SYSTEM_STATE.TOUCH_COLOR, height * touch_strength_smoother);
-        }
-      }
+  height *= height;
+  height *= height;
+  height *= height;
+  height *= height;
 
-      leds[3][15] = interpolate_CRGBF(leds[3][15], SYSTEM_STATE.TOUCH_COLOR, touch_strength_smoother);
-    }
-  }
-}
\ No newline at end of file
+  color = SYSTEM_STATE.TOUCH_COLOR;
+  alpha = height;
+}
+// #############################################################################################
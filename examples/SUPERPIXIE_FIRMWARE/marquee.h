@@ -0,0 +1,183 @@
+// #############################################################################################
+// Marquee scrolling
+//
+// Scrolling text across the chain used to mean a set_string() with shifted contents for every
+// step, paying for the whole chain transmission each time. Instead, the host sends the whole
+// string once with COM_SET_MARQUEE, along with a speed and a character pitch, and every node
+// works out for itself which part of the string is passing over it on every frame.
+//
+// The string is laid out one character per (pitch) LEDs, starting just past the last node in
+// the chain, and slides left at (speed) LEDs per second. A node at LOCAL_ADDRESS sees the part of
+// it that's (LOCAL_ADDRESS * pitch) LEDs in, which is at most two characters at once: the one
+// leaving over its left edge and the one entering from its right. Each is drawn from its own
+// character slot, picked by its index in the string, so a character keeps its slot the whole
+// way across the node and only the one entering ever needs loading.
+//
+// There's no clock shared by the whole chain, so the scroll starts (delay_ms) after the packet
+// arrives instead, less CHAIN_BYTE_TIME_US for every node the packet passed through on the way.
+//
+// The settings (marquee_settings in constants.h) are staged in RENDER_STATE_STAGED.MARQUEE on
+// the CPU core and reach the GPU core with the rest of the render state (render_state.h).
+
+#define MARQUEE_FLAG_LOOP (0x01)  // Start again once the string has scrolled off the chain
+
+marquee_settings marquee;  // Only ever touched by the GPU core
+char marquee_resume_character = ' ';  // What was on screen before the marquee started
+
+uint32_t marquees_started = 0;
+
+// #############################################################################################
+// GPU core: put the characters back where transitions expect them once the marquee is over,
+// showing whatever was on screen before it started
+void end_marquee() {
+  marquee.LENGTH = 0;
+
+  for (uint8_t slot = 0; slot < 2; slot++) {
+    memcpy(&CHARACTER_STATE[slot], &CHARACTER_STATE_DEFAULTS, sizeof(character_state));
+  }
+
+  set_line_memory_character(current_character_state, marquee_resume_character);
+  CHARACTER_STATE[current_character_state].OPACITY = 1.0;
+  CHARACTER_STATE[!current_character_state].OPACITY = 0.0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: place one character of the string (index) at (x), loading it into its slot first
+// if that slot still holds a different one
+void place_marquee_character(int32_t index, float x) {
+  uint8_t slot = index & 1;
+
+  char character = ' ';  // Nothing to show before the start or after the end of the string
+  if (index >= 0 && index < marquee.LENGTH) {
+    character = marquee.STRING[index];
+  }
+
+  if (line_memory_character[slot] != character) {
+    set_line_memory_character(slot, character);
+  }
+
+  CHARACTER_STATE[slot].POSITION.x = x;
+  CHARACTER_STATE[slot].POSITION.y = 0.0;
+  CHARACTER_STATE[slot].SCALE.x = 1.0;
+  CHARACTER_STATE[slot].SCALE.y = 1.0;
+  CHARACTER_STATE[slot].ROTATION = 0.0;
+  CHARACTER_STATE[slot].OPACITY = 1.0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: start, replace or stop the marquee, called by apply_render_state() when the CPU
+// core has staged new settings
+void apply_marquee_settings(const marquee_settings& settings) {
+  bool was_running = (marquee.LENGTH > 0);
+  memcpy(&marquee, &settings, sizeof(marquee_settings));
+
+  if (marquee.LENGTH == 0) {
+    if (was_running == true) {
+      end_marquee();
+    }
+    return;
+  }
+
+  if (was_running == false) {
+    marquee_resume_character = line_memory_character[current_character_state];
+  }
+  marquees_started++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: scroll the marquee to the current frame, called by prepare_character_layer() in
+// place of run_character_transitions(). Returns false when there's no marquee running.
+bool run_marquee() {
+  if (marquee.LENGTH == 0) {
+    return false;
+  }
+
+  // Hold the string just off the right end of the chain until it starts
+  uint32_t elapsed_ms = 0;
+  if (int32_t(time_ms_now - marquee.START_MS) > 0) {
+    elapsed_ms = time_ms_now - marquee.START_MS;
+  }
+
+  // Long enough for the last character to clear the first node
+  float travel = (marquee.LENGTH + marquee.CHAIN_LENGTH) * marquee.PITCH;
+  uint32_t period_ms = travel * 1000.0 / marquee.SPEED;
+  if (period_ms == 0) {
+    period_ms = 1;
+  }
+
+  if (marquee.LOOP == true) {
+    elapsed_ms %= period_ms;  // Integer milliseconds, so a long running loop doesn't lose precision
+  }
+  else if (elapsed_ms >= period_ms) {
+    end_marquee();
+    return false;
+  }
+
+  // Position in the string under this node's center
+  float scroll = elapsed_ms * marquee.SPEED / 1000.0;
+  float u = scroll + (int16_t(marquee.LOCAL_ADDRESS) - marquee.CHAIN_LENGTH) * marquee.PITCH;
+
+  int32_t index = floor(u / marquee.PITCH);
+  float x = index * marquee.PITCH - u;  // Between -PITCH and 0.0
+
+  place_marquee_character(index, x);
+  place_marquee_character(index + 1, x + marquee.PITCH);
+
+  return true;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: stage the marquee from a COM_SET_MARQUEE packet for the GPU core. (data) is a flags
+// byte, the speed in hundredths of an LED per second and the start delay in milliseconds as big
+// endian 16-bit values, the pitch in tenths of an LED, and then the string. An empty string
+// stops the marquee.
+void set_marquee_packet(const uint8_t* data, uint8_t data_length, uint8_t local_address, uint8_t chain_length, bool bus_mode) {
+  uint32_t arrival_ms = millis();
+
+  if (data_length < 6) {
+    return;
+  }
+
+  uint8_t flags = data[0];
+  uint16_t speed_x100 = (data[1] << 8) + data[2];
+  uint16_t delay_ms = (data[3] << 8) + data[4];
+  uint8_t pitch_x10 = data[5];
+
+  uint8_t length = data_length - 6;
+  if (length > MARQUEE_MAX_LENGTH) {
+    length = MARQUEE_MAX_LENGTH;
+  }
+
+  // A stopped pitch or speed would never scroll anywhere
+  if (speed_x100 == 0 || pitch_x10 == 0) {
+    length = 0;
+  }
+
+  marquee_settings& staged = RENDER_STATE_STAGED.MARQUEE;
+  memcpy(staged.STRING, &data[6], length);
+  staged.LENGTH = length;
+  staged.LOOP = (flags & MARQUEE_FLAG_LOOP);
+  staged.SPEED = speed_x100 / 100.0;
+  staged.PITCH = pitch_x10 / 10.0;
+  staged.LOCAL_ADDRESS = local_address;
+  staged.CHAIN_LENGTH = chain_length;
+
+  // On a bus every node hears the packet at the same time
+  uint32_t hop_delay_ms = 0;
+  if (bus_mode == false) {
+    hop_delay_ms = (uint32_t(local_address) * CHAIN_BYTE_TIME_US) / 1000;
+  }
+  staged.START_MS = arrival_ms + delay_ms - hop_delay_ms;
+
+  RENDER_STATE_STAGED.MARQUEE_SERIAL++;
+  render_state_dirty = true;
+}
+// #############################################################################################
@@ -49,6 +49,47 @@ inline bool is_point_in_bounding_box(float x, float y, float x1, float y1, float
 // #############################################################################################
 
 
+// #############################################################################################
+// Build the transform that scales, then rotates (in degrees), then offsets a point
+transform_2D make_transform_2D(vec2D offset, vec2D scale, float rotation) {
+  transform_2D transform = { scale.x, 0.0, 0.0, scale.y, offset.x, offset.y };
+
+  rotation = fmod(rotation, 360.0);
+  if (rotation != 0.0000) {
+    // Convert angle from degrees to radians
+    float angle_rad = rotation * M_PI / 180.0;
+    float cos_angle = cos(angle_rad);
+    float sin_angle = sin(angle_rad);
+
+    transform.m00 = scale.x * cos_angle;
+    transform.m01 = -scale.y * sin_angle;
+    transform.m10 = scale.x * sin_angle;
+    transform.m11 = scale.y * cos_angle;
+  }
+
+  return transform;
+}
+
+// Get the transform that undoes (transform), returning false if it collapses space to a line
+bool invert_transform_2D(const transform_2D& transform, transform_2D& inverse) {
+  float determinant = transform.m00 * transform.m11 - transform.m01 * transform.m10;
+  if (fabs(determinant) < 0.000001) {
+    return false;
+  }
+
+  float inverse_determinant = 1.0 / determinant;
+  inverse.m00 = transform.m11 * inverse_determinant;
+  inverse.m01 = -transform.m01 * inverse_determinant;
+  inverse.m10 = -transform.m10 * inverse_determinant;
+  inverse.m11 = transform.m00 * inverse_determinant;
+  inverse.tx = -(inverse.m00 * transform.tx + inverse.m01 * transform.ty);
+  inverse.ty = -(inverse.m10 * transform.tx + inverse.m11 * transform.ty);
+
+  return true;
+}
+// #############################################################################################
+
+
 // #############################################################################################
 // Interpolate between two CRGBF colors
 CRGBF interpolate_CRGBF( CRGBF color_a, CRGBF color_b, float blend ){
@@ -127,35 +168,3 @@ float clip_float(float input){
   return output;
 }
 // #############################################################################################
-
-float interpolate_curve(float input_linear, uint8_t interpolation_type){
-  input_linear = clip_float(input_linear);
-  if(interpolation_type == LINEAR){
-    return input_linear;
-  }
-  else if(interpolation_type == EASE_IN){
-    return input_linear * input_linear;
-  }
-  else if(interpolation_type == EASE_OUT){
-    return sqrt(input_linear);
-  }
-  else if(interpolation_type == EASE_IN_SOFT){
-    return input_linear * input_linear * input_linear;
-  }
-  else if(interpolation_type == EASE_OUT_SOFT){
-    return sqrt(sqrt(input_linear));
-  }
-  else if(interpolation_type == S_CURVE){
-    float a_val = input_linear * input_linear;
-    float b_val = sqrt(input_linear);
-    return ((a_val * (1.0 - input_linear)) + (b_val * (input_linear)));
-  }
-  else if(interpolation_type == S_CURVE_SOFT){
-    float a_val = input_linear * input_linear * input_linear;
-    float b_val = sqrt(sqrt(input_linear));
-    return ((a_val * (1.0 - input_linear)) + (b_val * (input_linear)));
-  }
-  else{
-    return 0.0F;
-  }
-}
\ No newline at end of file
@@ -0,0 +1,214 @@
+// #############################################################################################
+// Parallel LED output
+//
+// The default output path calls showLeds() on all seven CLEDControllers one after another, so
+// the lanes of the LED highway are clocked out serially. With LED_OUTPUT_PARALLEL set to 1 in
+// constants.h, the seven lanes are instead bit-transposed into a single 8-bit wide bitstream
+// (one bit per lane per time slot) and sent all at once through the I2S peripheral in LCD
+// (i80) mode, cutting the time spent clocking LEDs per frame by about 7x.
+//
+// Each WS2812B data bit is expanded into three time slots clocked at 2.4MHz:
+//
+//   [ 1 ][ bit ][ 0 ]  ->  417ns high for a 0, 833ns high for a 1, 1.25us per bit
+//
+// The encoder below only depends on CRGB and plain integer math, so `make check` in
+// extras/native compiles it natively and checks it against encode_parallel_frame_reference()
+// without any ESP32 hardware.
+
+#define LED_PARALLEL_LANES 8         // Width of the parallel bus, lane 7 is unused
+#define LED_PARALLEL_SLOTS_PER_BIT 3
+#define LED_PARALLEL_PCLK_HZ 2400000  // 3 slots per 1.25us WS2812B bit
+#define LED_PARALLEL_RESET_SLOTS 720  // 300us of low time to latch the LEDs (newer WS2812B need 280us)
+
+// Bytes of bitstream needed to encode a frame of (leds_per_lane) RGB LEDs on every lane
+#define LED_PARALLEL_FRAME_BYTES(leds_per_lane) ((leds_per_lane) * 24 * LED_PARALLEL_SLOTS_PER_BIT + LED_PARALLEL_RESET_SLOTS)
+
+// Pins only used by the I2S LCD mode, they need to be routed somewhere but are not read by
+// anything on the SuperPixie PCB
+#define LED_PARALLEL_WR_GPIO 21
+#define LED_PARALLEL_DC_GPIO 22
+#define LED_PARALLEL_SPARE_GPIO 19
+
+
+// #############################################################################################
+// Transpose an 8x8 bit matrix: out[k] holds bit (7-k) of every in[lane], with in[lane]'s bit
+// stored at bit position (lane) of out[k]. This turns 8 lane bytes into 8 parallel time slots,
+// MSB first, in a handful of 32-bit operations instead of 64 individual bit reads.
+inline void transpose_lanes_8x8(const uint8_t in[8], uint8_t out[8]) {
+  uint32_t x = (uint32_t(in[7]) << 24) | (uint32_t(in[6]) << 16) | (uint32_t(in[5]) << 8) | in[4];
+  uint32_t y = (uint32_t(in[3]) << 24) | (uint32_t(in[2]) << 16) | (uint32_t(in[1]) << 8) | in[0];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  out[0] = x >> 24;
+  out[1] = x >> 16;
+  out[2] = x >> 8;
+  out[3] = x;
+  out[4] = y >> 24;
+  out[5] = y >> 16;
+  out[6] = y >> 8;
+  out[7] = y;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Encode (num_lanes) strips of (leds_per_lane) CRGBs, stored lane after lane, into a parallel
+// WS2812B bitstream in GRB order. (output) must hold LED_PARALLEL_FRAME_BYTES(leds_per_lane).
+void encode_parallel_frame(const CRGB* lanes, uint8_t num_lanes, uint16_t leds_per_lane, uint8_t* output) {
+  uint8_t lane_mask = (1 << num_lanes) - 1;
+  uint8_t lane_bytes[LED_PARALLEL_LANES] = { 0 };
+  uint8_t slots[8];
+  uint32_t index = 0;
+
+  for (uint16_t i = 0; i < leds_per_lane; i++) {
+    for (uint8_t channel = 0; channel < 3; channel++) {
+      for (uint8_t lane = 0; lane < num_lanes; lane++) {
+        const CRGB& col = lanes[lane * leds_per_lane + i];
+        if (channel == 0) {
+          lane_bytes[lane] = col.g;
+        } else if (channel == 1) {
+          lane_bytes[lane] = col.r;
+        } else {
+          lane_bytes[lane] = col.b;
+        }
+      }
+
+      transpose_lanes_8x8(lane_bytes, slots);
+
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        output[index + 0] = lane_mask;  // Every lane goes high at the start of a bit
+        output[index + 1] = slots[bit];  // Lanes sending a 1 stay high
+        output[index + 2] = 0;          // Every lane goes low for the rest of the bit
+        index += LED_PARALLEL_SLOTS_PER_BIT;
+      }
+    }
+  }
+
+  memset(output + index, 0, LED_PARALLEL_RESET_SLOTS);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Bit-by-bit version of encode_parallel_frame(), slow but obviously correct. Kept as the
+// reference to check the transposition kernel against.
+void encode_parallel_frame_reference(const CRGB* lanes, uint8_t num_lanes, uint16_t leds_per_lane, uint8_t* output) {
+  uint32_t index = 0;
+
+  for (uint16_t i = 0; i < leds_per_lane; i++) {
+    for (uint8_t channel = 0; channel < 3; channel++) {
+      for (int8_t bit = 7; bit >= 0; bit--) {
+        uint8_t slot_high = 0;
+        uint8_t slot_data = 0;
+
+        for (uint8_t lane = 0; lane < num_lanes; lane++) {
+          const CRGB& col = lanes[lane * leds_per_lane + i];
+          uint8_t value = (channel == 0) ? col.g : ((channel == 1) ? col.r : col.b);
+
+          bitWrite(slot_high, lane, 1);
+          bitWrite(slot_data, lane, bitRead(value, bit));
+        }
+
+        output[index++] = slot_high;
+        output[index++] = slot_data;
+        output[index++] = 0;
+      }
+    }
+  }
+
+  for (uint16_t i = 0; i < LED_PARALLEL_RESET_SLOTS; i++) {
+    output[index++] = 0;
+  }
+}
+// #############################################################################################
+
+
+#if LED_OUTPUT_PARALLEL == 1
+
+#include "esp_lcd_panel_io.h"
+
+esp_lcd_i80_bus_handle_t parallel_bus = NULL;
+esp_lcd_panel_io_handle_t parallel_io = NULL;
+
+// Set from the I2S DMA interrupt once the last slot of a frame has been clocked out
+volatile bool parallel_output_busy = false;
+
+// #############################################################################################
+// Called from the DMA interrupt when a frame has finished transmitting
+static bool IRAM_ATTR on_parallel_output_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t* event_data, void* user_ctx) {
+  parallel_output_busy = false;
+  return false;  // No higher priority task was woken
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Configure the I2S peripheral in LCD mode to drive all lanes of the LED highway in parallel
+void init_parallel_output(const uint8_t* lane_pins, uint8_t num_lanes, uint32_t max_frame_bytes) {
+  esp_lcd_i80_bus_config_t bus_config = {};
+  bus_config.dc_gpio_num = LED_PARALLEL_DC_GPIO;
+  bus_config.wr_gpio_num = LED_PARALLEL_WR_GPIO;
+  bus_config.clk_src = LCD_CLK_SRC_DEFAULT;
+  bus_config.bus_width = LED_PARALLEL_LANES;
+  bus_config.max_transfer_bytes = max_frame_bytes;
+
+  for (uint8_t lane = 0; lane < LED_PARALLEL_LANES; lane++) {
+    if (lane < num_lanes) {
+      bus_config.data_gpio_nums[lane] = lane_pins[lane];
+    } else {
+      bus_config.data_gpio_nums[lane] = LED_PARALLEL_SPARE_GPIO;
+    }
+  }
+
+  esp_lcd_new_i80_bus(&bus_config, &parallel_bus);
+
+  esp_lcd_panel_io_i80_config_t io_config = {};
+  io_config.cs_gpio_num = -1;
+  io_config.pclk_hz = LED_PARALLEL_PCLK_HZ;
+  io_config.trans_queue_depth = 2;
+  io_config.on_color_trans_done = on_parallel_output_done;
+  io_config.lcd_cmd_bits = 8;
+  io_config.lcd_param_bits = 8;
+  io_config.dc_levels.dc_data_level = 1;
+
+  esp_lcd_new_panel_io_i80(parallel_bus, &io_config, &parallel_io);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Block until the previous frame has been clocked out of the I2S peripheral
+inline void wait_parallel_output() {
+  while (parallel_output_busy == true) {
+    // Spin, a frame takes well under a millisecond
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Start clocking out an encoded frame, returning as soon as the DMA transfer is queued. The
+// buffer must not be touched until wait_parallel_output() returns.
+void start_parallel_output(const uint8_t* frame, uint32_t frame_bytes) {
+  wait_parallel_output();
+
+  parallel_output_busy = true;
+  esp_lcd_panel_io_tx_color(parallel_io, -1, frame, frame_bytes);  // -1: no command phase
+}
+// #############################################################################################
+
+#endif
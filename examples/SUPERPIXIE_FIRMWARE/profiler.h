@@ -0,0 +1,174 @@
+// #############################################################################################
+// Frame profiler
+//
+// Times every stage of loop_gpu() (see profile_stages in constants.h) with the CPU cycle
+// counter, so the host can see where frame time goes with COM_GET_FPS, without a USB cable.
+//
+// profile_lap() charges the cycles since the last lap to a stage, and can be called any number
+// of times per frame: the three touch layers all add to PROFILE_TOUCH, for example. Once per
+// frame, profile_end_frame() adds each stage's total for the frame to its histogram, along with
+// the length of the whole frame as PROFILE_FRAME.
+//
+// Histograms have PROFILE_SUB_BUCKETS buckets per power of two of microseconds, so any sample is
+// within 1/PROFILE_SUB_BUCKETS of the bucket it lands in. When a bucket fills up, every bucket of
+// that stage is halved, so older frames slowly count for less. Minimum and average are exact.
+
+#define PROFILER_ENABLED 1  // Set to 0 to compile out every profile_lap()
+
+#define PROFILE_SUB_BUCKETS 8
+#define PROFILE_BUCKETS (PROFILE_SUB_BUCKETS * 14)  // Up to 65535 us
+#define PROFILE_STAGES_PER_PACKET 8  // 6 bytes each, after a 3 byte header
+
+struct profile_histogram {
+  uint16_t BUCKETS[PROFILE_BUCKETS];
+  uint16_t MIN_US;
+  uint32_t SAMPLES;
+  uint64_t TOTAL_CYCLES;  // Kept in cycles so stages shorter than a microsecond still average right
+};
+
+// Written by the GPU core, read by send_profile() on the CPU core
+profile_histogram profile_histograms[NUM_PROFILE_STAGES];
+volatile bool profile_reset_requested = true;
+
+// Only ever touched by the GPU core
+uint32_t profile_frame_cycles[NUM_PROFILE_STAGES];
+uint32_t profile_lap_cycles = 0;
+uint32_t profile_frame_start_cycles = 0;
+
+// #############################################################################################
+// Histogram bucket of a (sample_us) microsecond sample
+inline uint8_t get_profile_bucket(uint16_t sample_us) {
+  if (sample_us < PROFILE_SUB_BUCKETS) {
+    return sample_us;
+  }
+
+  uint8_t exponent = 31 - __builtin_clz(sample_us);  // At least 3
+  uint8_t sub_bucket = (sample_us >> (exponent - 3)) & (PROFILE_SUB_BUCKETS - 1);
+  return PROFILE_SUB_BUCKETS * (exponent - 2) + sub_bucket;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// The middle of the range of samples that land in (bucket)
+inline uint16_t get_profile_bucket_value(uint8_t bucket) {
+  if (bucket < PROFILE_SUB_BUCKETS) {
+    return bucket;
+  }
+
+  uint8_t exponent = bucket / PROFILE_SUB_BUCKETS + 2;
+  uint8_t sub_bucket = bucket % PROFILE_SUB_BUCKETS;
+  uint16_t width = 1 << (exponent - 3);
+  return (PROFILE_SUB_BUCKETS + sub_bucket) * width + width / 2;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: charge the cycles since the last lap to (stage)
+inline void profile_lap(uint8_t stage) {
+#if PROFILER_ENABLED == 1
+  uint32_t cycles_now = ESP.getCycleCount();
+  profile_frame_cycles[stage] += cycles_now - profile_lap_cycles;
+  profile_lap_cycles = cycles_now;
+#endif
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: add one sample to (stage)'s histogram
+void add_profile_sample(uint8_t stage, uint32_t cycles) {
+  uint32_t sample_us = cycles / (F_CPU / 1000000);
+  if (sample_us > 0xFFFF) {
+    sample_us = 0xFFFF;
+  }
+
+  profile_histogram& histogram = profile_histograms[stage];
+  uint8_t bucket = get_profile_bucket(sample_us);
+
+  if (histogram.BUCKETS[bucket] == 0xFFFF) {
+    for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+      histogram.BUCKETS[i] >>= 1;
+    }
+  }
+  histogram.BUCKETS[bucket]++;
+
+  if (histogram.SAMPLES == 0 || sample_us < histogram.MIN_US) {
+    histogram.MIN_US = sample_us;
+  }
+  histogram.SAMPLES++;
+  histogram.TOTAL_CYCLES += cycles;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: add this frame's stage totals to their histograms and start timing the next frame,
+// called once at the end of every frame
+void profile_end_frame() {
+#if PROFILER_ENABLED == 1
+  uint32_t cycles_now = ESP.getCycleCount();
+
+  if (profile_reset_requested == true) {
+    memset(profile_histograms, 0, sizeof(profile_histograms));
+    profile_reset_requested = false;
+  }
+  else {
+    profile_frame_cycles[PROFILE_FRAME] = cycles_now - profile_frame_start_cycles;
+    for (uint8_t stage = 0; stage < NUM_PROFILE_STAGES; stage++) {
+      add_profile_sample(stage, profile_frame_cycles[stage]);
+    }
+  }
+
+  memset(profile_frame_cycles, 0, sizeof(profile_frame_cycles));
+  profile_frame_start_cycles = cycles_now;
+  profile_lap_cycles = cycles_now;
+#endif
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: the sample 99% of (histogram)'s samples are at or below
+uint16_t get_profile_p99(const profile_histogram& histogram) {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+    total += histogram.BUCKETS[i];
+  }
+
+  uint32_t target = total - total / 100;
+  uint32_t count = 0;
+  for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+    count += histogram.BUCKETS[i];
+    if (count >= target && count > 0) {
+      return get_profile_bucket_value(i);
+    }
+  }
+
+  return 0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: fill (data) with the minimum, average and 99th percentile of (stage) in
+// microseconds, as big endian 16-bit values
+void get_profile_stage(uint8_t stage, uint8_t* data) {
+  const profile_histogram& histogram = profile_histograms[stage];
+
+  uint16_t min_us = histogram.MIN_US;
+  uint16_t avg_us = 0;
+  if (histogram.SAMPLES > 0) {
+    avg_us = histogram.TOTAL_CYCLES / histogram.SAMPLES / (F_CPU / 1000000);
+  }
+  uint16_t p99_us = get_profile_p99(histogram);
+
+  data[0] = min_us >> 8;
+  data[1] = min_us & 0xFF;
+  data[2] = avg_us >> 8;
+  data[3] = avg_us & 0xFF;
+  data[4] = p99_us >> 8;
+  data[5] = p99_us & 0xFF;
+}
+// #############################################################################################
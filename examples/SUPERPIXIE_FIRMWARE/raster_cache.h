@@ -0,0 +1,123 @@
+// #############################################################################################
+// Raster cache
+//
+// Most frames draw a character that hasn't moved since the last one, and every spin or push
+// transition runs through the same handful of transforms again and again, yet each frame the
+// glyph would be rastered from scratch. Instead, finished character masks are kept in a small
+// least recently used cache, keyed by the character and its transform quantized to
+// RASTER_CACHE_POSITION_STEPS, RASTER_CACHE_SCALE_STEPS and RASTER_CACHE_ROTATION_STEPS.
+//
+// Glyphs are always rastered at the quantized transform, so a character looks the same whether
+// or not it came from the cache. Masks are stored at full opacity: brightness scales linearly
+// with opacity, so fades reuse the same mask instead of needing an entry per opacity.
+//
+// Each entry holds one float mask of LEDS_X * LEDS_Y, 420 bytes on a 7x15 panel.
+
+#define RASTER_CACHE_ENTRIES 16
+
+#define RASTER_CACHE_POSITION_STEPS 16  // Steps per LED
+#define RASTER_CACHE_SCALE_STEPS 64     // Steps per 1.0 of scale
+#define RASTER_CACHE_ROTATION_STEPS 2   // Steps per degree
+
+// A character and its quantized transform
+struct raster_cache_key {
+  char CHARACTER;
+  int16_t POSITION_X;
+  int16_t POSITION_Y;
+  int16_t SCALE_X;
+  int16_t SCALE_Y;
+  int16_t ROTATION;
+};
+
+struct raster_cache_entry {
+  raster_cache_key KEY;  // KEY.CHARACTER is 0 if this entry is unused
+  uint32_t LAST_USED;    // Value of raster_cache_clock when this mask was last requested
+  float MASK[LEDS_X][LEDS_Y];
+};
+
+raster_cache_entry raster_cache[RASTER_CACHE_ENTRIES];
+uint32_t raster_cache_clock = 0;
+
+uint32_t raster_cache_hits = 0;
+uint32_t raster_cache_misses = 0;
+
+// #############################################################################################
+// Quantize a character's transform into a cache key
+raster_cache_key make_raster_cache_key(char character, vec2D pos, vec2D scale, float rotation) {
+  raster_cache_key key;
+  key.CHARACTER = character;
+  key.POSITION_X = lroundf(pos.x * RASTER_CACHE_POSITION_STEPS);
+  key.POSITION_Y = lroundf(pos.y * RASTER_CACHE_POSITION_STEPS);
+  key.SCALE_X = lroundf(scale.x * RASTER_CACHE_SCALE_STEPS);
+  key.SCALE_Y = lroundf(scale.y * RASTER_CACHE_SCALE_STEPS);
+  key.ROTATION = lroundf(fmod(rotation, 360.0) * RASTER_CACHE_ROTATION_STEPS);
+
+  return key;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Get the transform a cache key stands for
+void get_raster_cache_transform(const raster_cache_key& key, vec2D& pos, vec2D& scale, float& rotation) {
+  pos.x = float(key.POSITION_X) / RASTER_CACHE_POSITION_STEPS;
+  pos.y = float(key.POSITION_Y) / RASTER_CACHE_POSITION_STEPS;
+  scale.x = float(key.SCALE_X) / RASTER_CACHE_SCALE_STEPS;
+  scale.y = float(key.SCALE_Y) / RASTER_CACHE_SCALE_STEPS;
+  rotation = float(key.ROTATION) / RASTER_CACHE_ROTATION_STEPS;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Compare two keys field by field, so struct padding can't cause a false miss
+inline bool raster_cache_keys_match(const raster_cache_key& a, const raster_cache_key& b) {
+  return (a.CHARACTER == b.CHARACTER && a.POSITION_X == b.POSITION_X && a.POSITION_Y == b.POSITION_Y && a.SCALE_X == b.SCALE_X && a.SCALE_Y == b.SCALE_Y && a.ROTATION == b.ROTATION);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Empty the cache
+void init_raster_cache() {
+  for (uint8_t i = 0; i < RASTER_CACHE_ENTRIES; i++) {
+    raster_cache[i].KEY.CHARACTER = 0;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Get the index of the cached mask for (key). On a miss, the least recently used entry is
+// taken over and its mask cleared, (hit) is set to false, and the caller has to raster into it.
+int8_t get_raster_cache_entry(const raster_cache_key& key, bool& hit) {
+  raster_cache_clock++;
+
+  int8_t oldest_entry = 0;
+  for (uint8_t i = 0; i < RASTER_CACHE_ENTRIES; i++) {
+    raster_cache_entry& entry = raster_cache[i];
+
+    if (entry.KEY.CHARACTER != 0 && raster_cache_keys_match(entry.KEY, key) == true) {
+      entry.LAST_USED = raster_cache_clock;
+      raster_cache_hits++;
+      hit = true;
+      return i;
+    }
+
+    // Unused entries always count as the oldest
+    if (entry.KEY.CHARACTER == 0 || (raster_cache[oldest_entry].KEY.CHARACTER != 0 && entry.LAST_USED < raster_cache[oldest_entry].LAST_USED)) {
+      oldest_entry = i;
+    }
+  }
+
+  raster_cache_misses++;
+  hit = false;
+
+  raster_cache_entry& entry = raster_cache[oldest_entry];
+  entry.KEY = key;
+  entry.LAST_USED = raster_cache_clock;
+  memset(entry.MASK, 0, sizeof(entry.MASK));
+
+  return oldest_entry;
+}
+// #############################################################################################
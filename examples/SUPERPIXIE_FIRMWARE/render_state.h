@@ -0,0 +1,244 @@
+// #############################################################################################
+// CPU -> GPU state handoff
+//
+// Everything the CPU core changes about what should be drawn (packets from the UART chain,
+// touch readings, check_data()'s error screen) is written only to RENDER_STATE_STAGED, which
+// belongs to the CPU core alone. Once per loop_cpu() iteration, publish_render_state() copies
+// the staged block into a triple buffer, and once per frame consume_render_state() hands the
+// GPU core the newest complete copy. The GPU core then renders the whole frame against that
+// snapshot, so it can never see half of a packet's changes, and neither core ever blocks the
+// other.
+//
+// One-shot events (a new character, a show() call) can't be coalesced like settings can, so
+// they're pushed in order into render_command_ring instead, a single-producer/single-consumer
+// ring that the GPU core drains at the start of every frame. Queued commands only become
+// visible to the GPU core when the snapshot they were staged alongside is published, so a
+// show() never starts a transition before the settings sent ahead of it have arrived.
+
+#include <atomic>
+
+struct render_state {
+  system_state NEXT_SYSTEM_STATE;  // Target of the next transition
+  uint32_t SYSTEM_STATE_SERIAL;    // Incremented whenever NEXT_SYSTEM_STATE changes
+
+  // Applied to SYSTEM_STATE immediately, outside of transitions
+  uint8_t TRANSITION_INTERPOLATION;
+  uint8_t TOUCH_GLOW_POSITION;
+  CRGBF TOUCH_COLOR;
+  bool TOUCH_ACTIVE;
+  uint16_t TOUCH_VALUE;
+
+  float FRAME_BLENDING_AMOUNT;
+  float DEBUG_LED_OPACITY;
+
+  uint8_t GAMMA_CURVE;       // See gamma.h
+  float GAMMA_EXPONENT;      // Only used by GAMMA_POWER
+  uint32_t GAMMA_SERIAL;     // Incremented whenever GAMMA_CURVE or GAMMA_EXPONENT change
+
+  uint8_t DITHER_MODE;            // See dithering.h
+  uint8_t DITHER_MIN_FLICKER_HZ;  // Only used by DITHER_ADAPTIVE
+  uint32_t DITHER_SERIAL;         // Incremented whenever DITHER_MODE or DITHER_MIN_FLICKER_HZ change
+
+  marquee_settings MARQUEE;  // See marquee.h
+  uint32_t MARQUEE_SERIAL;   // Incremented whenever MARQUEE changes
+
+  clock_settings CLOCK;      // See clock_mode.h
+  uint32_t CLOCK_SERIAL;     // Incremented whenever CLOCK changes
+};
+
+#define RENDER_STATE_FRESH (0x80)  // Set on render_state_middle when it holds an unread snapshot
+#define RENDER_STATE_INDEX (0x03)
+
+render_state RENDER_STATE_STAGED;     // Only ever touched by the CPU core
+render_state RENDER_STATE_BUFFER[3];  // Triple buffer between the two cores
+
+uint8_t render_state_back = 0;                 // Owned by the CPU core
+std::atomic<uint8_t> render_state_middle(1);  // Swapped between the two cores
+uint8_t render_state_front = 2;                // Owned by the GPU core
+
+bool render_state_dirty = false;       // Set by the CPU core whenever RENDER_STATE_STAGED changes
+uint32_t render_state_publishes = 0;  // Number of snapshots published since boot
+
+// A list of all commands the CPU core can queue for the GPU core
+enum render_command_types {
+  RENDER_COMMAND_LOAD_CHARACTER,
+  RENDER_COMMAND_START_TRANSITION,
+  RENDER_COMMAND_SPAWN_EFFECT,
+  RENDER_COMMAND_QUEUE_STEP,
+  RENDER_COMMAND_CLEAR_QUEUE,
+  RENDER_COMMAND_SET_TRANSITION_TRACK,
+  RENDER_COMMAND_SET_EASING_POINTS,
+};
+
+struct render_command {
+  uint8_t TYPE;
+  char CHARACTER;             // Only used by RENDER_COMMAND_LOAD_CHARACTER
+  effect_parameters EFFECT;   // Only used by RENDER_COMMAND_SPAWN_EFFECT
+  sequence_step STEP;         // Only used by RENDER_COMMAND_QUEUE_STEP
+
+  // Only used by RENDER_COMMAND_SET_TRANSITION_TRACK
+  uint8_t TRANSITION;             // 0 for TRANSITION_CUSTOM_A
+  uint8_t TRACK_INDEX;
+  custom_transition_track TRACK;
+
+  // Only used by RENDER_COMMAND_SET_EASING_POINTS
+  uint8_t EASING_SLOT;            // 0 for CUSTOM_CURVE_A
+  uint8_t FIRST_POINT;
+  uint8_t NUM_POINTS;
+  uint8_t POINTS[EASING_CUSTOM_POINTS_PER_PACKET];
+};
+
+#define RENDER_COMMAND_RING_SIZE 32  // Must be a power of two
+#define RENDER_COMMAND_RING_MASK (RENDER_COMMAND_RING_SIZE - 1)
+
+render_command render_command_ring[RENDER_COMMAND_RING_SIZE];
+
+uint32_t render_command_staged_head = 0;        // Owned by the CPU core, not yet published
+std::atomic<uint32_t> render_command_head(0);  // Written by the CPU core on publish
+std::atomic<uint32_t> render_command_tail(0);  // Written by the GPU core as it drains
+uint32_t render_commands_dropped = 0;          // Commands lost to a full ring since boot
+
+// #############################################################################################
+// Reset the staged state to the boot defaults and make it visible to the GPU core
+void init_render_state() {
+  memcpy(&RENDER_STATE_STAGED.NEXT_SYSTEM_STATE, &SYSTEM_STATE_DEFAULTS, sizeof(system_state));
+  RENDER_STATE_STAGED.SYSTEM_STATE_SERIAL = 0;
+
+  RENDER_STATE_STAGED.TRANSITION_INTERPOLATION = SYSTEM_STATE_DEFAULTS.TRANSITION_INTERPOLATION;
+  RENDER_STATE_STAGED.TOUCH_GLOW_POSITION = SYSTEM_STATE_DEFAULTS.TOUCH_GLOW_POSITION;
+  RENDER_STATE_STAGED.TOUCH_COLOR = SYSTEM_STATE_DEFAULTS.TOUCH_COLOR;
+  RENDER_STATE_STAGED.TOUCH_ACTIVE = SYSTEM_STATE_DEFAULTS.TOUCH_ACTIVE;
+  RENDER_STATE_STAGED.TOUCH_VALUE = SYSTEM_STATE_DEFAULTS.TOUCH_VALUE;
+
+  RENDER_STATE_STAGED.FRAME_BLENDING_AMOUNT = 0.0;
+  RENDER_STATE_STAGED.DEBUG_LED_OPACITY = 0.0;
+
+  RENDER_STATE_STAGED.GAMMA_CURVE = gamma_curve;
+  RENDER_STATE_STAGED.GAMMA_EXPONENT = gamma_exponent;
+  RENDER_STATE_STAGED.GAMMA_SERIAL = 0;
+
+  RENDER_STATE_STAGED.DITHER_MODE = dither_mode;
+  RENDER_STATE_STAGED.DITHER_MIN_FLICKER_HZ = dither_min_flicker_hz;
+  RENDER_STATE_STAGED.DITHER_SERIAL = 0;
+
+  memset(&RENDER_STATE_STAGED.MARQUEE, 0, sizeof(marquee_settings));
+  RENDER_STATE_STAGED.MARQUEE_SERIAL = 0;
+
+  memset(&RENDER_STATE_STAGED.CLOCK, 0, sizeof(clock_settings));
+  RENDER_STATE_STAGED.CLOCK_SERIAL = 0;
+
+  // The GPU core isn't running yet, so all three buffers can simply be filled
+  for (uint8_t i = 0; i < 3; i++) {
+    memcpy(&RENDER_STATE_BUFFER[i], &RENDER_STATE_STAGED, sizeof(render_state));
+  }
+
+  render_state_back = 0;
+  render_state_middle.store(1);
+  render_state_front = 2;
+  render_state_dirty = false;
+
+  render_command_staged_head = 0;
+  render_command_head.store(0);
+  render_command_tail.store(0);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: mark NEXT_SYSTEM_STATE as changed after writing to it
+inline void stage_system_state_change() {
+  RENDER_STATE_STAGED.SYSTEM_STATE_SERIAL++;
+  render_state_dirty = true;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: queue a command for the GPU core, returning false if the ring is full. This never
+// waits on the GPU core, so the UART task can go straight back to receiving.
+bool push_render_command(const render_command& command) {
+  uint32_t tail = render_command_tail.load(std::memory_order_acquire);
+
+  if (render_command_staged_head - tail >= RENDER_COMMAND_RING_SIZE) {
+    render_commands_dropped++;
+    return false;
+  }
+
+  render_command_ring[render_command_staged_head & RENDER_COMMAND_RING_MASK] = command;
+
+  render_command_staged_head++;
+  render_state_dirty = true;  // Make sure it gets published
+
+  return true;
+}
+
+bool push_render_command(uint8_t type, char character = 0) {
+  render_command command;
+  command.TYPE = type;
+  command.CHARACTER = character;
+
+  return push_render_command(command);
+}
+// ###############################################################################################
+
+
+// #############################################################################################
+// CPU core: if anything was staged since the last call, hand a copy of it to the GPU core
+void publish_render_state() {
+  if (render_state_dirty == false) {
+    return;
+  }
+
+  memcpy(&RENDER_STATE_BUFFER[render_state_back], &RENDER_STATE_STAGED, sizeof(render_state));
+
+  // Trade the freshly written buffer for whichever one is in the middle, the GPU core is
+  // guaranteed not to be reading either of them
+  uint8_t previous_middle = render_state_middle.exchange(render_state_back | RENDER_STATE_FRESH, std::memory_order_acq_rel);
+  render_state_back = previous_middle & RENDER_STATE_INDEX;
+
+  // Only now release the commands queued alongside this snapshot
+  render_command_head.store(render_command_staged_head, std::memory_order_release);
+
+  render_state_dirty = false;
+  render_state_publishes++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: get the newest published snapshot, which stays untouched until the next call
+const render_state& consume_render_state() {
+  if (render_state_middle.load(std::memory_order_acquire) & RENDER_STATE_FRESH) {
+    uint8_t previous_middle = render_state_middle.exchange(render_state_front, std::memory_order_acq_rel);
+    render_state_front = previous_middle & RENDER_STATE_INDEX;
+  }
+
+  return RENDER_STATE_BUFFER[render_state_front];
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: get the index one past the last published command. Read this before calling
+// consume_render_state(), so the snapshot is at least as new as the commands drained with it.
+inline uint32_t get_render_command_head() {
+  return render_command_head.load(std::memory_order_acquire);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: take the oldest command queued before (head), returning false when there are none
+bool pop_render_command(uint32_t head, render_command& command) {
+  uint32_t tail = render_command_tail.load(std::memory_order_relaxed);
+
+  if (tail == head) {
+    return false;
+  }
+
+  command = render_command_ring[tail & RENDER_COMMAND_RING_MASK];
+  render_command_tail.store(tail + 1, std::memory_order_release);
+
+  return true;
+}
+// #############################################################################################
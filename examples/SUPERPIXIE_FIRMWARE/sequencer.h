@@ -0,0 +1,108 @@
+// #############################################################################################
+// Sequence queue
+//
+// Showing a sequence of characters used to take a character, show() and wait() from the host
+// for every step, over the slow chain. Instead, the host can queue a whole sequence at once with
+// COM_QUEUE_SEQUENCE: up to SEQUENCE_STEPS_PER_PACKET steps per packet, each with its own
+// character, transition, transition duration and hold time. run_sequence_queue() then plays it
+// back on the GPU core, one frame at a time, without ever waiting, and the bus stays idle.
+//
+// Each step starts once the previous step's transition has finished and its hold time has
+// passed. A COM_SHOW from the host still works as before, and the next queued step waits for the
+// transition it started to finish.
+
+#define SEQUENCE_QUEUE_SIZE 64  // Must be a power of two
+#define SEQUENCE_QUEUE_MASK (SEQUENCE_QUEUE_SIZE - 1)
+
+#define SEQUENCE_STEPS_PER_PACKET 9  // 6 bytes each, after a flags byte
+#define SEQUENCE_FLAG_REPLACE (0x01)  // Clear the queue before adding the packet's steps
+
+// Only ever touched by the GPU core
+sequence_step sequence_queue[SEQUENCE_QUEUE_SIZE];
+uint16_t sequence_queue_head = 0;
+uint16_t sequence_queue_tail = 0;
+
+uint32_t sequence_hold_end_ms = 0;  // When the last step started has been held long enough
+
+uint32_t sequence_steps_played = 0;
+uint32_t sequence_steps_dropped = 0;  // Steps lost to a full queue
+
+// #############################################################################################
+// GPU core: add a step to the end of the queue, called by apply_render_state()
+void queue_sequence_step(const sequence_step& step) {
+  if (uint16_t(sequence_queue_head - sequence_queue_tail) >= SEQUENCE_QUEUE_SIZE) {
+    sequence_steps_dropped++;
+    return;
+  }
+
+  sequence_queue[sequence_queue_head & SEQUENCE_QUEUE_MASK] = step;
+  sequence_queue_head++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: drop every step that hasn't started yet, the one on screen finishes as usual
+void clear_sequence_queue() {
+  sequence_queue_tail = sequence_queue_head;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: start the next queued step once the last one is done, called once per frame
+void run_sequence_queue() {
+  if (sequence_queue_tail == sequence_queue_head) {
+    return;  // Nothing queued
+  }
+
+  if (transition_running == true || int32_t(time_ms_now - sequence_hold_end_ms) < 0) {
+    return;  // Still showing the last step
+  }
+
+  const sequence_step& step = sequence_queue[sequence_queue_tail & SEQUENCE_QUEUE_MASK];
+  sequence_queue_tail++;
+
+  uint8_t transition_type = step.TRANSITION_TYPE;
+  if (transition_type >= NUM_TRANSITIONS || step.TRANSITION_DURATION_MS == 0) {
+    transition_type = TRANSITION_INSTANT;
+  }
+
+  load_new_character(step.CHARACTER);
+  start_transition(transition_type, step.TRANSITION_DURATION_MS);
+
+  sequence_hold_end_ms = time_ms_now + step.TRANSITION_DURATION_MS + step.HOLD_MS;
+  sequence_steps_played++;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: queue the steps of a COM_QUEUE_SEQUENCE packet for the GPU core. (data) is a flags
+// byte, then CHARACTER, TRANSITION_TYPE, TRANSITION_DURATION_MS and HOLD_MS for every step,
+// with both times as big endian 16-bit values.
+void queue_sequence_packet(const uint8_t* data, uint8_t data_length) {
+  uint8_t flags = data[0];
+  if (flags & SEQUENCE_FLAG_REPLACE) {
+    push_render_command(RENDER_COMMAND_CLEAR_QUEUE);
+  }
+
+  uint8_t num_steps = (data_length - 1) / 6;
+  if (num_steps > SEQUENCE_STEPS_PER_PACKET) {
+    num_steps = SEQUENCE_STEPS_PER_PACKET;
+  }
+
+  for (uint8_t i = 0; i < num_steps; i++) {
+    const uint8_t* step_data = &data[1 + i * 6];
+
+    render_command command;
+    command.TYPE = RENDER_COMMAND_QUEUE_STEP;
+    command.STEP.CHARACTER = step_data[0];
+    command.STEP.TRANSITION_TYPE = step_data[1];
+    command.STEP.TRANSITION_DURATION_MS = (step_data[2] << 8) + step_data[3];
+    command.STEP.HOLD_MS = (step_data[4] << 8) + step_data[5];
+
+    push_render_command(command);
+  }
+}
+// #############################################################################################
@@ -0,0 +1,208 @@
+// #############################################################################################
+// Framebuffer streaming
+//
+// For anything the font can't draw, the host can render whole frames itself and stream them to
+// a node with COM_STREAM_FRAME. A frame is LEDS_X * LEDS_Y pixels, row by row from the top left,
+// which doesn't fit in a single packet even as 4-bit palette indices, so it's sent as fragments:
+//
+//   [0] Frame sequence number, wrapping at 256
+//   [1] Encoding, one of stream_encodings in constants.h
+//   [2] Index of the fragment's first pixel (or first palette entry for STREAM_SET_PALETTE)
+//   [3] Pixel data, up to STREAM_MAX_FRAGMENT_DATA bytes
+//
+// Fragments of a frame have to arrive in order, and a frame is only shown once its last pixel
+// has arrived. A fragment that doesn't pick up where the last one left off means one was lost,
+// so the rest of that frame is dropped. A fragment from a frame older than the last one started
+// arrived late, and is dropped as well.
+//
+// Frames are assembled on the CPU core straight into the back buffer of a triple buffer, and
+// handed over whole the same way render_state.h hands over snapshots, so the GPU core only ever
+// sees complete frames and neither core waits on the other. If frames arrive faster than
+// they're drawn, only the newest is shown. The stream layer (see init_compositor()) draws it
+// with BLEND_REPLACE on top of the characters. Effects, touch glow and the debug LEDs are still
+// drawn on top. STREAM_STOP goes back to drawing characters.
+
+#include <atomic>
+
+#define STREAM_PIXELS (LEDS_X * LEDS_Y)
+#define STREAM_FRAGMENT_HEADER 3
+#define STREAM_MAX_FRAGMENT_DATA 51  // Largest packet the library sends, less the header
+#define STREAM_PALETTE_SIZE 16
+
+struct stream_buffer {
+  uint8_t PIXELS[STREAM_PIXELS][3];
+  bool ACTIVE;  // False for STREAM_STOP
+};
+
+#define STREAM_BUFFER_FRESH (0x80)  // Set on stream_middle when it holds an unread frame
+#define STREAM_BUFFER_INDEX (0x03)
+
+stream_buffer stream_buffers[3];         // Triple buffer between the two cores
+uint8_t stream_back = 0;                 // Owned by the CPU core, frames are assembled here
+std::atomic<uint8_t> stream_middle(1);  // Swapped between the two cores
+uint8_t stream_front = 2;                // Owned by the GPU core
+
+// Only ever touched by the CPU core
+uint8_t stream_palette[STREAM_PALETTE_SIZE][3];
+uint8_t stream_sequence = 0;       // Sequence number of the last frame started
+bool stream_sequence_valid = false; // False until the first frame since boot or STREAM_STOP
+bool stream_assembling = false;     // True while the frame in the back buffer is incomplete
+uint8_t stream_next_pixel = 0;
+
+// Only ever touched by the GPU core
+CRGBF stream_frame[LEDS_X][LEDS_Y];
+bool stream_active = false;
+
+uint32_t stream_frames_received = 0;
+uint32_t stream_frames_dropped = 0;  // Incomplete, missing a fragment
+uint32_t stream_frames_late = 0;     // Older than a frame already started
+
+// #############################################################################################
+// CPU core: set pixel (index) of the frame being assembled to palette entry (entry)
+inline void set_stream_pixel_from_palette(uint8_t index, uint8_t entry) {
+  memcpy(stream_buffers[stream_back].PIXELS[index], stream_palette[entry & (STREAM_PALETTE_SIZE - 1)], 3);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: hand the back buffer to the GPU core, in exchange for whichever buffer is in the
+// middle. The GPU core is guaranteed not to be reading either of them.
+void publish_stream_buffer() {
+  uint8_t previous_middle = stream_middle.exchange(stream_back | STREAM_BUFFER_FRESH, std::memory_order_acq_rel);
+  stream_back = previous_middle & STREAM_BUFFER_INDEX;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: decode one fragment's pixels into the back buffer, returning the index of the
+// pixel after the last one decoded
+uint8_t decode_stream_fragment(uint8_t encoding, uint8_t pixel, const uint8_t* data, uint8_t data_length) {
+  if (encoding == STREAM_RGB) {
+    for (uint8_t i = 0; i + 3 <= data_length && pixel < STREAM_PIXELS; i += 3) {
+      memcpy(stream_buffers[stream_back].PIXELS[pixel++], &data[i], 3);
+    }
+  }
+  else if (encoding == STREAM_PALETTE) {
+    for (uint8_t i = 0; i < data_length && pixel < STREAM_PIXELS; i++) {
+      set_stream_pixel_from_palette(pixel++, data[i] >> 4);
+      if (pixel < STREAM_PIXELS) {
+        set_stream_pixel_from_palette(pixel++, data[i]);
+      }
+    }
+  }
+  else if (encoding == STREAM_RLE) {
+    for (uint8_t i = 0; i < data_length; i++) {
+      uint8_t run_length = (data[i] >> 4) + 1;
+      for (uint8_t r = 0; r < run_length && pixel < STREAM_PIXELS; r++) {
+        set_stream_pixel_from_palette(pixel++, data[i]);
+      }
+    }
+  }
+
+  return pixel;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: handle one COM_STREAM_FRAME packet, handing the frame to the GPU core once its last
+// fragment has arrived
+void receive_stream_fragment(const uint8_t* data, uint8_t data_length) {
+  if (data_length < STREAM_FRAGMENT_HEADER) {
+    return;
+  }
+
+  uint8_t sequence = data[0];
+  uint8_t encoding = data[1];
+  uint8_t offset = data[2];
+  const uint8_t* fragment_data = &data[STREAM_FRAGMENT_HEADER];
+  uint8_t fragment_length = data_length - STREAM_FRAGMENT_HEADER;
+
+  if (encoding == STREAM_STOP) {
+    stream_sequence_valid = false;
+    stream_assembling = false;
+    stream_buffers[stream_back].ACTIVE = false;
+    publish_stream_buffer();
+    return;
+  }
+  else if (encoding == STREAM_SET_PALETTE) {
+    for (uint8_t i = 0; i + 3 <= fragment_length && offset < STREAM_PALETTE_SIZE; i += 3) {
+      memcpy(stream_palette[offset++], &fragment_data[i], 3);
+    }
+    return;
+  }
+  else if (encoding >= NUM_STREAM_ENCODINGS) {
+    return;
+  }
+
+  if (stream_sequence_valid == true && sequence != stream_sequence) {
+    if (int8_t(sequence - stream_sequence) < 0) {
+      stream_frames_late++;
+      return;
+    }
+
+    // A newer frame started before the last one was finished
+    if (stream_assembling == true) {
+      stream_frames_dropped++;
+    }
+  }
+
+  if (stream_sequence_valid == false || sequence != stream_sequence) {
+    stream_sequence = sequence;
+    stream_sequence_valid = true;
+    stream_assembling = true;
+    stream_next_pixel = 0;
+  }
+
+  if (stream_assembling == false) {
+    return;  // This frame is already complete, or was dropped
+  }
+
+  if (offset != stream_next_pixel) {
+    stream_assembling = false;
+    stream_frames_dropped++;
+    return;
+  }
+
+  stream_next_pixel = decode_stream_fragment(encoding, offset, fragment_data, fragment_length);
+
+  if (stream_next_pixel >= STREAM_PIXELS) {
+    stream_buffers[stream_back].ACTIVE = true;
+    publish_stream_buffer();
+
+    stream_assembling = false;
+    stream_frames_received++;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Compositor layer: the last complete frame streamed from the host, only shown while streaming
+bool prepare_stream_layer(compositor_layer& layer) {
+  if (stream_middle.load(std::memory_order_acquire) & STREAM_BUFFER_FRESH) {
+    uint8_t previous_middle = stream_middle.exchange(stream_front, std::memory_order_acq_rel);
+    stream_front = previous_middle & STREAM_BUFFER_INDEX;
+
+    const stream_buffer& buffer = stream_buffers[stream_front];
+    stream_active = buffer.ACTIVE;
+
+    for (uint8_t y = 0; y < LEDS_Y; y++) {
+      for (uint8_t x = 0; x < LEDS_X; x++) {
+        const uint8_t* pixel = buffer.PIXELS[y * LEDS_X + x];
+        stream_frame[x][y] = { pixel[0] / 255.0f, pixel[1] / 255.0f, pixel[2] / 255.0f };
+      }
+    }
+
+    layer.DIRTY = true;
+  }
+
+  return stream_active;
+}
+
+void stream_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  color = stream_frame[x][y];
+}
+// #############################################################################################
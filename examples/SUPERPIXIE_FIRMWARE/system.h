@@ -11,15 +11,26 @@ extern void init_storage();
 
 extern void init_chain_uart();
 extern void send_touch_event();
+
+extern void load_new_character(char character);
+
+extern void init_custom_transitions();
+extern void load_custom_transitions();
+extern void apply_custom_transition_track(const render_command& command);
+
+extern void load_timeline();
+
+extern void apply_marquee_settings(const marquee_settings& settings);
+extern void apply_clock_settings(const clock_settings& settings);
+
+extern void queue_sequence_step(const sequence_step& step);
+extern void clear_sequence_queue();
 //----------------------------------------------------------------
 
 // Timekeeping on the GPU core
 uint32_t time_us_now = 0;
 uint32_t time_ms_now = 0;
 
-// Halts the GPU core during sensitive changes
-bool freeze_led_image = false;
-
 // Set to true every time that a transition completes, and is
 // read/reset every time check_transition_completion() is called.
 // every call to trigger_transition() forces this to false again
@@ -42,6 +53,12 @@ float system_state_transition_progress_shaped = 1.0;
 uint32_t transition_start_ms = 0;
 uint32_t transition_end_ms = 0;
 bool transition_running = false;
+
+// Taken from the next system state when a transition starts, or from the sequence queue
+// (sequencer.h) when it starts one
+uint8_t active_transition_type = TRANSITION_INSTANT;
+uint32_t active_transition_duration_ms = 0;
+bool active_transition_reported = true;  // Whether the host hears about it finishing
 //----------------------------------------------------------------------------------------------
 
 TaskHandle_t cpu_task = NULL;
@@ -97,6 +114,8 @@ void init_system_states() {
   system_state_transition_progress_shaped = 1.0;
   transition_start_ms = 0;
   transition_end_ms = 0;
+
+  init_render_state();
 }
 // #############################################################################################
 
@@ -128,7 +147,10 @@ void init_system() {
   init_character_states();
   //------------------------------------
 
+  init_custom_transitions();
   init_fs();
+  load_custom_transitions();
+  load_timeline();
 }
 // #############################################################################################
 
@@ -136,8 +158,6 @@ void init_system() {
 // #############################################################################################
 // Interpolate the system states between old and new, swapping them when transitions are complete
 void run_system_transition() {
-  freeze_led_image = true;
-
   if (fade_in_complete == false) {
     GLOBAL_LED_BRIGHTNESS += 0.01;
 
@@ -160,10 +180,9 @@ void run_system_transition() {
 
   if (transition_running == true) {
     uint32_t time_elapsed_ms = time_ms_now - transition_start_ms;
-    uint32_t transition_duration_ms = SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_DURATION_MS;
-    system_state_transition_progress = clip_float(float(time_elapsed_ms) / float(transition_duration_ms));
+    system_state_transition_progress = clip_float(float(time_elapsed_ms) / float(active_transition_duration_ms));
 
-    if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_INSTANT) {
+    if (active_transition_type == TRANSITION_INSTANT || active_transition_duration_ms == 0) {
       system_state_transition_progress = 1.0;
       //here_flag = true;
     }
@@ -208,7 +227,7 @@ void run_system_transition() {
     if (system_state_transition_progress >= 1.0) {
       if (transition_running == true) {
         transition_running = false;
-        transition_complete_flag = true;
+        transition_complete_flag = active_transition_reported;
         system_state_transition_progress = 0.0;
         system_state_transition_progress_shaped = 0.0;
       }
@@ -230,20 +249,22 @@ void run_system_transition() {
       transition_running = false;
     }
   }
-
-  freeze_led_image = false;
 }
 // #############################################################################################
 
 
 // #############################################################################################
-// Causes run_system_transition() to begin interpolating the system states
-// run_character_transitions() is also triggered by these changes
-// This is functionally a "show()" equivalent
-void trigger_transition() {
+// GPU core: start interpolating from the current system state to the next one with a
+// (transition_type) transition, called by apply_render_state() when the CPU core has queued a
+// trigger_transition(), and by run_sequence_queue() and run_clock(). The host is only told when
+// it finishes if (reported) is true.
+void start_transition(uint8_t transition_type, uint32_t duration_ms, bool reported = true) {
   transition_start_ms = time_ms_now;
+  active_transition_type = transition_type;
+  active_transition_duration_ms = duration_ms;
+  active_transition_reported = reported;
 
-  if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_INSTANT) {
+  if (transition_type == TRANSITION_INSTANT) {
     system_state_transition_progress = 1.0;
     system_state_transition_progress_shaped = 1.0;
   } else {
@@ -257,11 +278,96 @@ void trigger_transition() {
 // #############################################################################################
 
 
+// #############################################################################################
+// GPU core: take the newest snapshot published by the CPU core and apply it before drawing
+// the frame, so the whole frame is rendered against one consistent set of changes
+void apply_render_state() {
+  static uint32_t applied_system_state_serial = 0;
+  static uint32_t applied_marquee_serial = 0;
+  static uint32_t applied_clock_serial = 0;
+  static uint32_t applied_gamma_serial = 0;
+  static uint32_t applied_dither_serial = 0;
+
+  uint32_t command_head = get_render_command_head();
+  const render_state& state = consume_render_state();
+
+  if (state.SYSTEM_STATE_SERIAL != applied_system_state_serial) {
+    memcpy(&SYSTEM_STATE_INTERNAL[!current_system_state], &state.NEXT_SYSTEM_STATE, sizeof(system_state));
+    system_state_changed = true;
+    applied_system_state_serial = state.SYSTEM_STATE_SERIAL;
+  }
+
+  // Run queued commands in the order they arrived, this is where glyphs get decoded
+  render_command command;
+  while (pop_render_command(command_head, command) == true) {
+    if (command.TYPE == RENDER_COMMAND_LOAD_CHARACTER) {
+      load_new_character(command.CHARACTER);
+    } else if (command.TYPE == RENDER_COMMAND_START_TRANSITION) {
+      start_transition(SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE, SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_DURATION_MS);
+    } else if (command.TYPE == RENDER_COMMAND_SPAWN_EFFECT) {
+      spawn_effect(command.EFFECT);
+    } else if (command.TYPE == RENDER_COMMAND_QUEUE_STEP) {
+      queue_sequence_step(command.STEP);
+    } else if (command.TYPE == RENDER_COMMAND_CLEAR_QUEUE) {
+      clear_sequence_queue();
+    } else if (command.TYPE == RENDER_COMMAND_SET_TRANSITION_TRACK) {
+      apply_custom_transition_track(command);
+    } else if (command.TYPE == RENDER_COMMAND_SET_EASING_POINTS) {
+      set_easing_curve_points(command.EASING_SLOT, command.FIRST_POINT, command.NUM_POINTS, command.POINTS);
+    }
+  }
+
+  // After the commands, so a marquee starting now resumes to the character loaded with it
+  if (state.MARQUEE_SERIAL != applied_marquee_serial) {
+    apply_marquee_settings(state.MARQUEE);
+    applied_marquee_serial = state.MARQUEE_SERIAL;
+  }
+
+  if (state.CLOCK_SERIAL != applied_clock_serial) {
+    apply_clock_settings(state.CLOCK);
+    applied_clock_serial = state.CLOCK_SERIAL;
+  }
+
+  // Rebuilding the gamma table here keeps it from changing under update_leds() mid-frame
+  if (state.GAMMA_SERIAL != applied_gamma_serial) {
+    apply_gamma_curve(state.GAMMA_CURVE, state.GAMMA_EXPONENT);
+    applied_gamma_serial = state.GAMMA_SERIAL;
+  }
+
+  if (state.DITHER_SERIAL != applied_dither_serial) {
+    apply_dither_mode(state.DITHER_MODE, state.DITHER_MIN_FLICKER_HZ);
+    applied_dither_serial = state.DITHER_SERIAL;
+  }
+
+  update_easing_curves();
+
+  SYSTEM_STATE.TRANSITION_INTERPOLATION = state.TRANSITION_INTERPOLATION;
+  SYSTEM_STATE.TOUCH_GLOW_POSITION = state.TOUCH_GLOW_POSITION;
+  SYSTEM_STATE.TOUCH_COLOR = state.TOUCH_COLOR;
+  SYSTEM_STATE.TOUCH_ACTIVE = state.TOUCH_ACTIVE;
+  SYSTEM_STATE.TOUCH_VALUE = state.TOUCH_VALUE;
+
+  frame_blending_amount = state.FRAME_BLENDING_AMOUNT;
+  debug_led_opacity = state.DEBUG_LED_OPACITY;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Causes run_system_transition() to begin interpolating the system states
+// run_character_transitions() is also triggered by these changes
+// This is functionally a "show()" equivalent
+void trigger_transition() {
+  push_render_command(RENDER_COMMAND_START_TRANSITION);
+}
+// #############################################################################################
+
+
 // #############################################################################################
 // Set the transition time in milliseconds
 void set_transition_time_ms(uint16_t time_ms) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_DURATION_MS = time_ms;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.TRANSITION_DURATION_MS = time_ms;
+  stage_system_state_change();
 }
 // #############################################################################################
 
@@ -269,25 +375,69 @@ void set_transition_time_ms(uint16_t time_ms) {
 // #############################################################################################
 // Set the transition type
 void set_transition_type(uint8_t transition_type) {
-  SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE = transition_type;
-  system_state_changed = true;
+  RENDER_STATE_STAGED.NEXT_SYSTEM_STATE.TRANSITION_TYPE = transition_type;
+  stage_system_state_change();
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Select a new gamma curve, the GPU core rebuilds its table before the next frame is quantized
+void set_gamma_curve(uint8_t curve, float exponent) {
+  if (curve >= NUM_GAMMA_CURVES) {
+    return;  // Unknown curve, keep the current one
+  }
+
+  if (exponent <= 0.0) {
+    exponent = 1.0;
+  }
+
+  RENDER_STATE_STAGED.GAMMA_CURVE = curve;
+  RENDER_STATE_STAGED.GAMMA_EXPONENT = exponent;
+  RENDER_STATE_STAGED.GAMMA_SERIAL++;
+  render_state_dirty = true;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Select between the fixed 8-step and adaptive dithering modes, applied by the GPU core
+// before the next frame is quantized
+void set_dither_mode(uint8_t mode, uint8_t min_flicker_hz) {
+  if (mode >= NUM_DITHER_MODES) {
+    return;  // Unknown mode, keep the current one
+  }
+
+  if (min_flicker_hz == 0) {
+    min_flicker_hz = 1;
+  }
+
+  RENDER_STATE_STAGED.DITHER_MODE = mode;
+  RENDER_STATE_STAGED.DITHER_MIN_FLICKER_HZ = min_flicker_hz;
+  RENDER_STATE_STAGED.DITHER_SERIAL++;
+  render_state_dirty = true;
 }
 // #############################################################################################
 
 
 void check_touch() {
-  SYSTEM_STATE.TOUCH_VALUE = touchRead(TOUCH_PIN);
+  uint16_t touch_value = touchRead(TOUCH_PIN);
+  if (touch_value != RENDER_STATE_STAGED.TOUCH_VALUE) {
+    RENDER_STATE_STAGED.TOUCH_VALUE = touch_value;
+    render_state_dirty = true;
+  }
 
-  float touch_strength = 1.0-clip_float((SYSTEM_STATE.TOUCH_VALUE - STORAGE.TOUCH_LOW_LEVEL) / (STORAGE.TOUCH_HIGH_LEVEL - STORAGE.TOUCH_LOW_LEVEL));
+  float touch_strength = 1.0-clip_float((RENDER_STATE_STAGED.TOUCH_VALUE - STORAGE.TOUCH_LOW_LEVEL) / (STORAGE.TOUCH_HIGH_LEVEL - STORAGE.TOUCH_LOW_LEVEL));
 
   bool touching = false;
   if (touch_strength <= STORAGE.TOUCH_THRESHOLD) {
     touching = true;
   }
 
-  if (touching != SYSTEM_STATE.TOUCH_ACTIVE) {
+  if (touching != RENDER_STATE_STAGED.TOUCH_ACTIVE) {
     if (time_ms_now >= 500) {  // If >= half second since boot
-      SYSTEM_STATE.TOUCH_ACTIVE = touching;
+      RENDER_STATE_STAGED.TOUCH_ACTIVE = touching;
+      render_state_dirty = true;
       send_touch_event();
     }
   }
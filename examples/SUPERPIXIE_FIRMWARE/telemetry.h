@@ -0,0 +1,302 @@
+// #############################################################################################
+// Binary telemetry
+//
+// Every TELEMETRY_INTERVAL_MS, the CPU core copies the variables in telemetry_fields into one
+// compact record and trickles it out of chain_right, a few bytes at a time as the UART's transmit
+// buffer has room, so neither core ever waits on the port. scripts/telemetry_decoder.py turns the
+// records back into columns.
+//
+// Records are self-describing: every TELEMETRY_SCHEMA_INTERVAL data records, and first thing
+// after boot, a schema record lists the name and type of each field. Data records carry only the
+// packed values and the ID of the schema they follow, so adding a field here needs no changes on
+// the host. Every record is framed as:
+//
+//   0xA5 0x5A, TELEMETRY_VERSION, record type, payload length (16-bit), payload, checksum (16-bit)
+//
+// with multi-byte values little endian, as the ESP32 stores them, and a CRC-16 (CCITT) of
+// everything after the two sync bytes.
+//
+// chain_right is also the USB serial port, so records are only sent from the terminating node,
+// which has no other node on that side of it. While telemetry is on, that node stops forwarding
+// chain traffic out of chain_right, and sends no packets of its own that way (see
+// telemetry_owns_chain_right()). A record goes out in chunks as the transmit buffer has room,
+// and nothing else can land between them and break its checksum.
+//
+// The CPU core copies each field while the GPU core keeps running, so a data record isn't an
+// atomic snapshot. Every value is copied whole, but values the GPU core writes (frame timings,
+// transition progress, cache counters, ...) can come from neighbouring frames within one record.
+// They're fine for trends over many records, but don't compare them to each other within one.
+
+#define TELEMETRY_INTERVAL_MS 1000     // 0 to turn telemetry off. About 220 bytes per record.
+#define TELEMETRY_SCHEMA_INTERVAL 30   // Data records between repeats of the schema
+#define TELEMETRY_VERSION 1            // Bump whenever the framing below changes
+
+#define TELEMETRY_SYNC_A (0xA5)
+#define TELEMETRY_SYNC_B (0x5A)
+#define TELEMETRY_HEADER 6
+#define TELEMETRY_CHECKSUM 2
+#define TELEMETRY_BUFFER_SIZE 2048     // Big enough for the schema record, about 1.5 KB today
+#define TELEMETRY_MAX_PAYLOAD (TELEMETRY_BUFFER_SIZE - TELEMETRY_HEADER - TELEMETRY_CHECKSUM)
+
+struct telemetry_field {
+  const char* NAME;
+  const void* ADDRESS;
+  uint8_t TYPE;  // One of telemetry_types
+};
+
+const uint8_t telemetry_type_sizes[NUM_TELEMETRY_TYPES] = { 1, 1, 2, 4, 4, 4 };
+
+// The type of a variable, worked out by the compiler so the field table can't disagree with it
+constexpr uint8_t get_telemetry_type(const bool&) { return TELEMETRY_BOOL; }
+constexpr uint8_t get_telemetry_type(const uint8_t&) { return TELEMETRY_U8; }
+constexpr uint8_t get_telemetry_type(const uint16_t&) { return TELEMETRY_U16; }
+constexpr uint8_t get_telemetry_type(const uint32_t&) { return TELEMETRY_U32; }
+constexpr uint8_t get_telemetry_type(const int32_t&) { return TELEMETRY_I32; }
+constexpr uint8_t get_telemetry_type(const float&) { return TELEMETRY_FLOAT; }
+
+#define TELEMETRY_FIELD(variable) { #variable, &(variable), get_telemetry_type(variable) }
+
+// Values that have to be asked for, refreshed just before every snapshot
+uint32_t free_heap_size = 0;
+uint32_t cpu_stack_free = 0;
+uint32_t gpu_stack_free = 0;
+
+uint32_t telemetry_records_sent = 0;
+uint32_t telemetry_records_skipped = 0;  // Due while the last record was still going out
+
+const telemetry_field telemetry_fields[] = {
+  TELEMETRY_FIELD(CHAIN_CONFIG.LOCAL_ADDRESS),
+  TELEMETRY_FIELD(CHAIN_CONFIG.CHAIN_LENGTH),
+  TELEMETRY_FIELD(CHAIN_CONFIG.PROPAGATION_MODE),
+  TELEMETRY_FIELD(CHAIN_CONFIG.BUS_MODE),
+  TELEMETRY_FIELD(last_probe_tx_time_ms),
+  TELEMETRY_FIELD(probe_timeout_ms),
+  TELEMETRY_FIELD(probe_timeout_occurred),
+  TELEMETRY_FIELD(probe_packet_received),
+  TELEMETRY_FIELD(terminating_node),
+  TELEMETRY_FIELD(propagation_queued),
+  TELEMETRY_FIELD(assignment_complete),
+  TELEMETRY_FIELD(discovery_complete),
+  TELEMETRY_FIELD(rx_drop_start),
+  TELEMETRY_FIELD(rx_drop_duration),
+  TELEMETRY_FIELD(rx_low),
+  TELEMETRY_FIELD(show_called_once),
+  TELEMETRY_FIELD(upstream_packets_receieved),
+  TELEMETRY_FIELD(time_ms_now),
+  TELEMETRY_FIELD(time_us_now),
+  TELEMETRY_FIELD(free_heap_size),
+  TELEMETRY_FIELD(cpu_stack_free),
+  TELEMETRY_FIELD(gpu_stack_free),
+  TELEMETRY_FIELD(frame_blending_amount),
+  TELEMETRY_FIELD(debug_led_opacity),
+  TELEMETRY_FIELD(fade_in_complete),
+  TELEMETRY_FIELD(GLOBAL_LED_BRIGHTNESS),
+  TELEMETRY_FIELD(render_state_publishes),
+  TELEMETRY_FIELD(transition_complete_flag),
+  TELEMETRY_FIELD(system_state_changed),
+  TELEMETRY_FIELD(current_system_state),
+  TELEMETRY_FIELD(system_state_transition_progress),
+  TELEMETRY_FIELD(system_state_transition_progress_shaped),
+  TELEMETRY_FIELD(transition_start_ms),
+  TELEMETRY_FIELD(transition_end_ms),
+  TELEMETRY_FIELD(transition_running),
+  TELEMETRY_FIELD(last_gpu_check_in),
+  TELEMETRY_FIELD(system_ready),
+  TELEMETRY_FIELD(SYSTEM_STATE.BRIGHTNESS),
+  TELEMETRY_FIELD(SYSTEM_STATE.TRANSITION_TYPE),
+  TELEMETRY_FIELD(SYSTEM_STATE.TRANSITION_DURATION_MS),
+  TELEMETRY_FIELD(SYSTEM_STATE.TOUCH_ACTIVE),
+  TELEMETRY_FIELD(SYSTEM_STATE.TOUCH_VALUE),
+  TELEMETRY_FIELD(STORAGE.TOUCH_THRESHOLD),
+  TELEMETRY_FIELD(STORAGE.TOUCH_HIGH_LEVEL),
+  TELEMETRY_FIELD(STORAGE.TOUCH_LOW_LEVEL),
+  TELEMETRY_FIELD(character_state_changed),
+  TELEMETRY_FIELD(current_character_state),
+  TELEMETRY_FIELD(dither_index),
+  TELEMETRY_FIELD(glyph_cache_hits),
+  TELEMETRY_FIELD(glyph_cache_misses),
+  TELEMETRY_FIELD(glyph_cache_evictions),
+  TELEMETRY_FIELD(raster_lines_tested),
+  TELEMETRY_FIELD(raster_lines_drawn),
+  TELEMETRY_FIELD(raster_glyphs_culled),
+  TELEMETRY_FIELD(raster_cache_hits),
+  TELEMETRY_FIELD(raster_cache_misses),
+  TELEMETRY_FIELD(compositor_passes),
+  TELEMETRY_FIELD(compositor_skipped),
+  TELEMETRY_FIELD(effects_spawned),
+  TELEMETRY_FIELD(effects_replaced),
+  TELEMETRY_FIELD(stream_frames_received),
+  TELEMETRY_FIELD(stream_frames_dropped),
+  TELEMETRY_FIELD(stream_frames_late),
+  TELEMETRY_FIELD(timeline_entries_played),
+  TELEMETRY_FIELD(timeline_entries_rejected),
+  TELEMETRY_FIELD(marquees_started),
+  TELEMETRY_FIELD(clock_ticks_shown),
+  TELEMETRY_FIELD(telemetry_records_sent),
+  TELEMETRY_FIELD(telemetry_records_skipped),
+};
+
+#define NUM_TELEMETRY_FIELDS (sizeof(telemetry_fields) / sizeof(telemetry_field))
+
+uint8_t telemetry_buffer[TELEMETRY_BUFFER_SIZE];
+uint16_t telemetry_length = 0;   // Bytes of the record in telemetry_buffer
+uint16_t telemetry_sent = 0;     // Bytes of it already handed to the UART
+
+uint16_t telemetry_schema_id = 0;
+uint16_t telemetry_sequence = 0;
+uint8_t telemetry_records_until_schema = 0;  // 0 to send the schema next
+uint32_t telemetry_last_ms = 0;
+
+// #############################################################################################
+// Whether chain_right is kept for telemetry records, instead of forwarding chain traffic that
+// nothing past the terminating node would receive anyway
+bool telemetry_owns_chain_right() {
+  return TELEMETRY_INTERVAL_MS != 0 && terminating_node == true;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CRC-16 (CCITT) of (length) bytes of (data)
+uint16_t get_telemetry_checksum(const uint8_t* data, uint16_t length) {
+  uint16_t crc = 0xFFFF;
+  for (uint16_t i = 0; i < length; i++) {
+    crc ^= data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      if (crc & 0x8000) {
+        crc = (crc << 1) ^ 0x1021;
+      }
+      else {
+        crc <<= 1;
+      }
+    }
+  }
+
+  return crc;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Wrap the (payload_length) bytes of payload already written after the header in telemetry_buffer
+// with the header and checksum, ready to send
+void finish_telemetry_record(uint8_t record_type, uint16_t payload_length) {
+  telemetry_buffer[0] = TELEMETRY_SYNC_A;
+  telemetry_buffer[1] = TELEMETRY_SYNC_B;
+  telemetry_buffer[2] = TELEMETRY_VERSION;
+  telemetry_buffer[3] = record_type;
+  telemetry_buffer[4] = payload_length & 0xFF;
+  telemetry_buffer[5] = payload_length >> 8;
+
+  uint16_t length = TELEMETRY_HEADER + payload_length;
+  uint16_t checksum = get_telemetry_checksum(&telemetry_buffer[2], length - 2);
+  telemetry_buffer[length + 0] = checksum & 0xFF;
+  telemetry_buffer[length + 1] = checksum >> 8;
+
+  telemetry_length = length + TELEMETRY_CHECKSUM;
+  telemetry_sent = 0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Build the schema record: the schema ID, the number of fields, then the type, name length and
+// name of each one. The ID is a checksum of the rest, so a new field table gets a new one.
+void build_telemetry_schema() {
+  uint8_t* payload = &telemetry_buffer[TELEMETRY_HEADER];
+  uint16_t index = 2;
+
+  payload[index++] = NUM_TELEMETRY_FIELDS;
+  for (uint8_t i = 0; i < NUM_TELEMETRY_FIELDS; i++) {
+    uint8_t name_length = strlen(telemetry_fields[i].NAME);
+    if (index + 2 + name_length > TELEMETRY_MAX_PAYLOAD) {
+      name_length = 0;  // Out of room, the host still gets the type so the values line up
+    }
+
+    payload[index++] = telemetry_fields[i].TYPE;
+    payload[index++] = name_length;
+    memcpy(&payload[index], telemetry_fields[i].NAME, name_length);
+    index += name_length;
+  }
+
+  telemetry_schema_id = get_telemetry_checksum(&payload[2], index - 2);
+  payload[0] = telemetry_schema_id & 0xFF;
+  payload[1] = telemetry_schema_id >> 8;
+
+  finish_telemetry_record(TELEMETRY_RECORD_SCHEMA, index);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Build a data record from the current value of every field: the schema ID, a sequence number
+// the host can spot dropped records with, then the values in field table order
+void build_telemetry_snapshot() {
+  free_heap_size = esp_get_free_heap_size();
+  cpu_stack_free = uxTaskGetStackHighWaterMark(cpu_task);
+  gpu_stack_free = uxTaskGetStackHighWaterMark(gpu_task);
+
+  uint8_t* payload = &telemetry_buffer[TELEMETRY_HEADER];
+  uint16_t index = 0;
+
+  payload[index++] = telemetry_schema_id & 0xFF;
+  payload[index++] = telemetry_schema_id >> 8;
+  payload[index++] = telemetry_sequence & 0xFF;
+  payload[index++] = telemetry_sequence >> 8;
+  telemetry_sequence++;
+
+  for (uint8_t i = 0; i < NUM_TELEMETRY_FIELDS; i++) {
+    uint8_t size = telemetry_type_sizes[telemetry_fields[i].TYPE];
+    memcpy(&payload[index], telemetry_fields[i].ADDRESS, size);
+    index += size;
+  }
+
+  finish_telemetry_record(TELEMETRY_RECORD_DATA, index);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: send whatever of the current record fits in the UART's transmit buffer, and start
+// the next one when it's due, called once per loop
+void run_telemetry() {
+  if (telemetry_owns_chain_right() == false) {
+    return;
+  }
+
+  if (telemetry_sent < telemetry_length) {
+    int32_t room = chain_right.availableForWrite();
+    if (room > 0) {
+      uint16_t chunk = telemetry_length - telemetry_sent;
+      if (chunk > room) {
+        chunk = room;
+      }
+
+      chain_right.write(&telemetry_buffer[telemetry_sent], chunk);
+      telemetry_sent += chunk;
+      if (telemetry_sent == telemetry_length) {
+        telemetry_records_sent++;
+      }
+    }
+  }
+
+  if (time_ms_now - telemetry_last_ms < TELEMETRY_INTERVAL_MS) {
+    return;
+  }
+  telemetry_last_ms = time_ms_now;
+
+  if (telemetry_sent < telemetry_length) {
+    telemetry_records_skipped++;  // The port can't keep up with this interval
+    return;
+  }
+
+  if (telemetry_records_until_schema == 0) {
+    build_telemetry_schema();
+    telemetry_records_until_schema = TELEMETRY_SCHEMA_INTERVAL;
+  }
+  else {
+    build_telemetry_snapshot();
+    telemetry_records_until_schema--;
+  }
+}
+// #############################################################################################
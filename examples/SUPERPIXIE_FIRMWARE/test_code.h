@@ -40,4 +40,131 @@ void line_drawing_test() {
       }
     }
   }
-}
\ No newline at end of file
+}
+
+// What benchmark_glyph_rendering() measured
+struct glyph_benchmark_results {
+  float BUILD_US;     // Per glyph
+  float SEGMENTS_US;  // Per draw
+  float SDF_US;       // Per draw that didn't fall back to the segments
+  uint32_t FALLBACKS;
+  float MAX_ERROR;
+  float MEAN_ERROR;
+  bool PASSED;        // Both errors within GLYPH_SDF_MAX_ERROR and GLYPH_SDF_MEAN_ERROR
+};
+
+// #############################################################################################
+// Render every glyph in the font through a spread of transforms with both the segment
+// rasterizer and the distance field renderer (glyph_sdf.h), timing each and measuring how far
+// the distance field output strays from the segments. Results are also printed over debug().
+// Run natively by extras/native/bench.cpp, which fails if the errors are out of bounds.
+glyph_benchmark_results benchmark_glyph_rendering() {
+  struct benchmark_transform {
+    vec2D pos;
+    vec2D scale;
+    float rotation;
+  };
+
+  const benchmark_transform transforms[] = {
+    { {  0.00,  0.00 }, { 1.00, 1.00 },   0.0 },  // At rest
+    { {  0.50, -0.25 }, { 1.00, 1.00 },   0.0 },  // Mid-push
+    { {  0.00,  0.00 }, { 1.00, 1.00 },  30.0 },  // Mid-spin
+    { {  0.25,  0.75 }, { 1.00, 1.00 }, 135.0 },
+    { {  0.00,  0.00 }, { 1.00, 1.00 }, 180.0 },
+    { {  0.00,  0.00 }, { 0.75, 0.75 },  60.0 },  // Mid-shrink
+    { {  0.00,  0.00 }, { 1.50, 1.50 },   0.0 },
+    { {  0.00,  0.00 }, { 0.80, 1.00 },   0.0 },  // Mid-flip, drawn with segments
+    { {  0.00,  0.00 }, { 1.00, 0.95 },   0.0 },
+  };
+  const uint8_t num_transforms = sizeof(transforms) / sizeof(benchmark_transform);
+
+  static glyph_distance_field field;
+  static float mask_segments[LEDS_X][LEDS_Y];
+  static float mask_sdf[LEDS_X][LEDS_Y];
+
+  // Timed in cycles, so draws shorter than a microsecond still add up
+  uint64_t build_cycles = 0;
+  uint64_t segments_cycles = 0;
+  uint64_t sdf_cycles = 0;
+  uint32_t fallbacks = 0;
+
+  float max_error = 0.0;
+  float total_error = 0.0;
+  uint32_t pixels_drawn = 0;
+
+  for (uint8_t i = 0; i < FONT_NUM_GLYPHS; i++) {
+    char character = FONT_FIRST_CHARACTER + i;
+    const font_glyph* glyph = get_font_glyph(character);
+
+    // Read straight from the font tables, so the glyph cache is left alone
+    glyph_mesh mesh = { &font_vertices[glyph->first_vertex], &font_lines[glyph->first_line], glyph->num_vertices, glyph->num_lines, { 0.0, 0.0 }, { 0.0, 0.0 } };
+    get_glyph_bounds(mesh.vertices, mesh.num_vertices, mesh.bounds_min, mesh.bounds_max);
+
+    uint32_t t_start = ESP.getCycleCount();
+    build_glyph_distance_field(mesh, character, field);
+    build_cycles += ESP.getCycleCount() - t_start;
+
+    for (uint8_t t = 0; t < num_transforms; t++) {
+      vec2D offset = { transforms[t].pos.x + 3, transforms[t].pos.y + 7 };
+      transform_2D transform = make_transform_2D(offset, transforms[t].scale, transforms[t].rotation);
+
+      memset(mask_segments, 0, sizeof(mask_segments));
+      memset(mask_sdf, 0, sizeof(mask_sdf));
+
+      t_start = ESP.getCycleCount();
+      draw_glyph_segments(mesh, mask_segments, transform, 1.0);
+      segments_cycles += ESP.getCycleCount() - t_start;
+
+      t_start = ESP.getCycleCount();
+      if (draw_glyph_distance_field(field, mask_sdf, transform, 1.0) == false) {
+        fallbacks++;
+        continue;
+      }
+      sdf_cycles += ESP.getCycleCount() - t_start;
+
+      for (uint8_t x = 0; x < LEDS_X; x++) {
+        for (uint8_t y = 0; y < LEDS_Y; y++) {
+          if (mask_segments[x][y] > 0.0 || mask_sdf[x][y] > 0.0) {
+            float error = fabs(mask_segments[x][y] - mask_sdf[x][y]);
+            if (error > max_error) {
+              max_error = error;
+            }
+
+            total_error += error;
+            pixels_drawn++;
+          }
+        }
+      }
+    }
+  }
+
+  const float cycles_per_us = F_CPU / 1000000;
+  uint32_t sdf_draws = FONT_NUM_GLYPHS * num_transforms - fallbacks;
+
+  glyph_benchmark_results results;
+  results.BUILD_US = build_cycles / cycles_per_us / FONT_NUM_GLYPHS;
+  results.SEGMENTS_US = segments_cycles / cycles_per_us / (FONT_NUM_GLYPHS * num_transforms);
+  results.SDF_US = (sdf_draws > 0) ? sdf_cycles / cycles_per_us / sdf_draws : 0.0;
+  results.FALLBACKS = fallbacks;
+  results.MAX_ERROR = max_error;
+  results.MEAN_ERROR = (pixels_drawn > 0) ? total_error / pixels_drawn : 0.0;
+  results.PASSED = (results.MAX_ERROR <= GLYPH_SDF_MAX_ERROR && results.MEAN_ERROR <= GLYPH_SDF_MEAN_ERROR);
+
+  debug("GLYPH RENDER BENCHMARK: ");
+  debugln(results.PASSED ? PASS : FAIL);
+  debug("  FIELD BUILD US PER GLYPH: ");
+  debugln(results.BUILD_US);
+  debug("  SEGMENTS US PER DRAW: ");
+  debugln(results.SEGMENTS_US);
+  debug("  SDF US PER DRAW: ");
+  debugln(results.SDF_US);
+  debug("  SDF FALLBACKS: ");
+  debugln(results.FALLBACKS);
+  debug("  MAX ERROR: ");
+  debugln(results.MAX_ERROR);
+  debug("  MEAN ERROR: ");
+  debugln(results.MEAN_ERROR);
+
+  return results;
+}
+// #############################################################################################
@@ -0,0 +1,377 @@
+// #############################################################################################
+// Animation timeline
+//
+// For animations that repeat, the host can upload a timeline of timestamped commands once with
+// COM_TIMELINE_ADD, and leave the node to play it back on its own clock with
+// COM_TIMELINE_CONTROL, without any more bus traffic. Each entry is an ordinary command (a color
+// change, a character, a show(), an effect, a brightness change, ...) with the time in
+// milliseconds from the start of the timeline that it should run at. Only commands that change
+// what's on screen can be added, see timeline_command_allowed().
+//
+// Entries are packed into a fixed arena as they arrive, and kept sorted by time in
+// timeline_entries[], so they can be uploaded in any order: a track of color changes, then a
+// track of characters, and so on. Entries with the same time run in the order they arrived.
+//
+// run_timeline() plays entries on the CPU core as their time comes, running them through
+// execute_packet() exactly as if they'd just arrived over the chain. Seeking only moves the
+// playhead, entries before the new position aren't run again. A looping timeline starts over
+// from 0 once it reaches its length.
+//
+// TIMELINE_SAVE writes the whole timeline to LittleFS, and it's loaded again at boot. If it was
+// saved with TIMELINE_FLAG_AUTOPLAY, it also starts playing as soon as the node boots, so a show
+// can run with no host at all.
+
+#define TIMELINE_ARENA_SIZE 4096
+#define TIMELINE_MAX_ENTRIES 256
+#define TIMELINE_ENTRY_HEADER 6           // Time, command type and data length
+#define TIMELINE_MAX_ENTRIES_PER_CALL 8   // So a burst of entries can't starve the UART chain
+#define TIMELINE_FILE "/TIMELINE.BIN"
+
+#define TIMELINE_FLAG_LOOP (0x01)
+#define TIMELINE_FLAG_AUTOPLAY (0x02)  // Start playing at boot, when saved
+
+struct timeline_header {
+  uint16_t ENTRY_COUNT;
+  uint16_t ARENA_USED;
+  uint8_t FLAGS;
+  uint32_t LENGTH_MS;  // Loop length, 0 to loop right after the last entry
+};
+
+// Only ever touched by the CPU core
+uint8_t timeline_arena[TIMELINE_ARENA_SIZE];
+uint16_t timeline_entries[TIMELINE_MAX_ENTRIES];  // Arena offsets, sorted by time
+timeline_header TIMELINE = { 0, 0, 0, 0 };
+
+bool timeline_playing = false;
+uint32_t timeline_start_ms = 0;     // millis() at position 0 of the current pass
+uint32_t timeline_paused_ms = 0;    // Position to resume from while paused
+uint16_t timeline_next_entry = 0;
+
+uint32_t timeline_entries_played = 0;
+uint32_t timeline_entries_rejected = 0;  // Full, or not a command a timeline can run
+
+// #############################################################################################
+// The time of the entry at (offset) in the arena
+inline uint32_t timeline_time_at(uint16_t offset) {
+  const uint8_t* entry = &timeline_arena[offset];
+  return (uint32_t(entry[0]) << 24) + (uint32_t(entry[1]) << 16) + (uint32_t(entry[2]) << 8) + entry[3];
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Commands a timeline can hold: everything that changes what's on screen, but nothing that
+// configures the chain, replies to the host or touches the timeline itself
+bool timeline_command_allowed(uint8_t command_type) {
+  switch (command_type) {
+    case COM_SET_BACKLIGHT_COLOR:
+    case COM_SET_FRAME_BLENDING:
+    case COM_SET_BRIGHTNESS:
+    case COM_SHOW:
+    case COM_SET_TRANSITION_TYPE:
+    case COM_SET_TRANSITION_DURATION_MS:
+    case COM_SET_CHARACTER:
+    case COM_SET_DEBUG_OVERLAY_OPACITY:
+    case COM_SET_DISPLAY_COLORS:
+    case COM_SET_GRADIENT_TYPE:
+    case COM_SET_STRING:
+    case COM_SET_TRANSITION_INTERPOLATION:
+    case COM_SET_TOUCH_GLOW_POSITION:
+    case COM_SET_TOUCH_GLOW_COLOR:
+    case COM_SET_GAMMA_CURVE:
+    case COM_SET_DITHER_MODE:
+    case COM_SPAWN_EFFECT:
+    case COM_QUEUE_SEQUENCE:
+    case COM_SET_MARQUEE:
+    case COM_STREAM_FRAME:
+    case COM_SET_CLOCK:
+      return true;
+  }
+
+  return false;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Index of the first entry at or after (position_ms)
+uint16_t find_timeline_entry(uint32_t position_ms) {
+  uint16_t low = 0;
+  uint16_t high = TIMELINE.ENTRY_COUNT;
+
+  while (low < high) {
+    uint16_t middle = (low + high) / 2;
+    if (timeline_time_at(timeline_entries[middle]) < position_ms) {
+      low = middle + 1;
+    }
+    else {
+      high = middle;
+    }
+  }
+
+  return low;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: add an entry from a COM_TIMELINE_ADD packet. (data) is the time as a big endian
+// 32-bit value, the command type, and then the command's own data.
+void add_timeline_entry(const uint8_t* data, uint8_t data_length) {
+  if (data_length < 5) {
+    return;
+  }
+
+  uint8_t command_type = data[4];
+  uint8_t command_length = data_length - 5;
+
+  if (timeline_command_allowed(command_type) == false || TIMELINE.ENTRY_COUNT >= TIMELINE_MAX_ENTRIES || TIMELINE.ARENA_USED + TIMELINE_ENTRY_HEADER + command_length > TIMELINE_ARENA_SIZE) {
+    timeline_entries_rejected++;
+    return;
+  }
+
+  uint16_t offset = TIMELINE.ARENA_USED;
+  uint8_t* entry = &timeline_arena[offset];
+  memcpy(entry, data, 5);  // Time and command type
+  entry[5] = command_length;
+  memcpy(&entry[TIMELINE_ENTRY_HEADER], &data[5], command_length);
+  TIMELINE.ARENA_USED += TIMELINE_ENTRY_HEADER + command_length;
+
+  // After every entry with the same time, so they keep the order they arrived in
+  uint32_t time_ms = timeline_time_at(offset);
+  uint16_t index = find_timeline_entry(time_ms + 1);
+  if (time_ms == 0xFFFFFFFF) {
+    index = TIMELINE.ENTRY_COUNT;
+  }
+
+  memmove(&timeline_entries[index + 1], &timeline_entries[index], (TIMELINE.ENTRY_COUNT - index) * sizeof(uint16_t));
+  timeline_entries[index] = offset;
+  TIMELINE.ENTRY_COUNT++;
+
+  // Keep the playhead on the same entry if this one went in ahead of it
+  if (timeline_playing == true && index < timeline_next_entry) {
+    timeline_next_entry++;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: the playhead's position in milliseconds from the start of the timeline
+uint32_t get_timeline_position() {
+  if (timeline_playing == false) {
+    return timeline_paused_ms;
+  }
+  return millis() - timeline_start_ms;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: move the playhead to (position_ms), without running anything before it
+void seek_timeline(uint32_t position_ms) {
+  timeline_start_ms = millis() - position_ms;
+  timeline_paused_ms = position_ms;
+  timeline_next_entry = find_timeline_entry(position_ms);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: drop every entry and stop playing
+void clear_timeline() {
+  TIMELINE.ENTRY_COUNT = 0;
+  TIMELINE.ARENA_USED = 0;
+  timeline_playing = false;
+  timeline_paused_ms = 0;
+  timeline_next_entry = 0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: load the timeline saved by save_timeline(), if there is one, and start playing it if
+// it was saved with TIMELINE_FLAG_AUTOPLAY. The whole file is checked before the timeline in RAM
+// is replaced, so a corrupt or outdated file leaves it as it was.
+void load_timeline() {
+  File file = LittleFS.open(TIMELINE_FILE, "r");
+  if (!file) {
+    return;  // Nothing saved yet
+  }
+
+  timeline_header header;
+  uint16_t entries[TIMELINE_MAX_ENTRIES];
+
+  bool valid = (file.read((uint8_t*)&header, sizeof(header)) == sizeof(header));
+  valid = valid && header.ENTRY_COUNT <= TIMELINE_MAX_ENTRIES && header.ARENA_USED <= TIMELINE_ARENA_SIZE;
+  valid = valid && file.read((uint8_t*)entries, header.ENTRY_COUNT * sizeof(uint16_t)) == header.ENTRY_COUNT * sizeof(uint16_t);
+
+  uint32_t arena_start = sizeof(header) + header.ENTRY_COUNT * sizeof(uint16_t);
+  valid = valid && file.size() >= arena_start + header.ARENA_USED;
+
+  // Drop anything run_timeline() couldn't safely play, or find_timeline_entry() couldn't search,
+  // rather than trusting the file. Only each entry's header is read here.
+  uint32_t last_time_ms = 0;
+  for (uint16_t i = 0; valid == true && i < header.ENTRY_COUNT; i++) {
+    uint16_t offset = entries[i];
+    uint8_t entry[TIMELINE_ENTRY_HEADER];
+
+    valid = (offset + TIMELINE_ENTRY_HEADER <= header.ARENA_USED);
+    valid = valid && file.seek(arena_start + offset) && file.read(entry, TIMELINE_ENTRY_HEADER) == TIMELINE_ENTRY_HEADER;
+    if (valid == false) {
+      break;
+    }
+
+    uint32_t time_ms = (uint32_t(entry[0]) << 24) + (uint32_t(entry[1]) << 16) + (uint32_t(entry[2]) << 8) + entry[3];
+    uint8_t command_type = entry[4];
+    uint8_t command_length = entry[5];
+
+    if (offset + TIMELINE_ENTRY_HEADER + command_length > header.ARENA_USED || command_length > sizeof(packet_data[0])) {
+      valid = false;
+    }
+    else if (timeline_command_allowed(command_type) == false || time_ms < last_time_ms) {
+      valid = false;
+    }
+
+    last_time_ms = time_ms;
+  }
+
+  valid = valid && file.seek(arena_start);
+
+  if (valid == false) {
+    file.close();
+    return;
+  }
+
+  clear_timeline();
+
+  if (file.read(timeline_arena, header.ARENA_USED) != header.ARENA_USED) {
+    file.close();
+    return;  // Cut short since it was checked, leave the timeline empty
+  }
+  file.close();
+
+  memcpy(timeline_entries, entries, header.ENTRY_COUNT * sizeof(uint16_t));
+  TIMELINE = header;
+
+  if (TIMELINE.FLAGS & TIMELINE_FLAG_AUTOPLAY) {
+    seek_timeline(0);
+    timeline_playing = true;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: write the timeline to LittleFS, to be loaded again at boot
+void save_timeline() {
+  File file = LittleFS.open(TIMELINE_FILE, "w+");
+  if (!file) {
+    return;
+  }
+
+  file.write((const uint8_t*)&TIMELINE, sizeof(TIMELINE));
+  file.write((const uint8_t*)timeline_entries, TIMELINE.ENTRY_COUNT * sizeof(uint16_t));
+  file.write(timeline_arena, TIMELINE.ARENA_USED);
+  file.close();
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: handle a COM_TIMELINE_CONTROL packet. (data) is one of timeline_operations, a flags
+// byte, and then a position and a loop length in milliseconds as big endian 32-bit values.
+void control_timeline(const uint8_t* data, uint8_t data_length) {
+  if (data_length < 10) {
+    return;
+  }
+
+  uint8_t operation = data[0];
+  uint8_t flags = data[1];
+  uint32_t position_ms = (uint32_t(data[2]) << 24) + (uint32_t(data[3]) << 16) + (uint32_t(data[4]) << 8) + data[5];
+  uint32_t length_ms = (uint32_t(data[6]) << 24) + (uint32_t(data[7]) << 16) + (uint32_t(data[8]) << 8) + data[9];
+
+  if (operation == TIMELINE_CLEAR) {
+    clear_timeline();
+  }
+  else if (operation == TIMELINE_PLAY) {
+    TIMELINE.FLAGS = flags;
+    TIMELINE.LENGTH_MS = length_ms;
+    seek_timeline(position_ms);
+    timeline_playing = true;
+  }
+  else if (operation == TIMELINE_PAUSE) {
+    timeline_paused_ms = get_timeline_position();
+    timeline_playing = false;
+  }
+  else if (operation == TIMELINE_RESUME) {
+    seek_timeline(timeline_paused_ms);
+    timeline_playing = true;
+  }
+  else if (operation == TIMELINE_SEEK) {
+    seek_timeline(position_ms);
+  }
+  else if (operation == TIMELINE_SAVE) {
+    TIMELINE.FLAGS = flags;
+    TIMELINE.LENGTH_MS = length_ms;
+    save_timeline();
+  }
+  else if (operation == TIMELINE_LOAD) {
+    load_timeline();
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: run every entry whose time has come, called once per loop_cpu() iteration
+void run_timeline() {
+  if (timeline_playing == false) {
+    return;
+  }
+
+  if (TIMELINE.ENTRY_COUNT == 0) {
+    timeline_playing = false;
+    return;
+  }
+
+  // A loop is never shorter than its last entry
+  uint32_t length_ms = timeline_time_at(timeline_entries[TIMELINE.ENTRY_COUNT - 1]) + 1;
+  if (TIMELINE.LENGTH_MS > length_ms) {
+    length_ms = TIMELINE.LENGTH_MS;
+  }
+
+  uint32_t position_ms = millis() - timeline_start_ms;
+
+  // Entries of this pass are all run before starting over
+  if (timeline_next_entry >= TIMELINE.ENTRY_COUNT && position_ms >= length_ms) {
+    if ((TIMELINE.FLAGS & TIMELINE_FLAG_LOOP) == 0) {
+      timeline_paused_ms = length_ms;
+      timeline_playing = false;
+      return;
+    }
+
+    // Whole passes missed while the CPU core was busy are skipped
+    timeline_start_ms += (position_ms / length_ms) * length_ms;
+    position_ms %= length_ms;
+    timeline_next_entry = 0;
+  }
+
+  for (uint8_t i = 0; i < TIMELINE_MAX_ENTRIES_PER_CALL && timeline_next_entry < TIMELINE.ENTRY_COUNT; i++) {
+    uint16_t offset = timeline_entries[timeline_next_entry];
+    if (timeline_time_at(offset) > position_ms) {
+      break;
+    }
+    timeline_next_entry++;
+
+    const uint8_t* entry = &timeline_arena[offset];
+    uint8_t command_length = entry[5];
+
+    memset(packet_data[TIMELINE_SOURCE], 0, sizeof(packet_data[TIMELINE_SOURCE]));
+    memcpy(packet_data[TIMELINE_SOURCE], &entry[TIMELINE_ENTRY_HEADER], command_length);
+    execute_packet(TIMELINE_SOURCE, ADDRESS_COMMANDER, 0, entry[4], command_length);
+
+    timeline_entries_played++;
+  }
+}
+// #############################################################################################
@@ -1,163 +1,423 @@
-// Instantly switch to the new system state
-void run_instant_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress;
-}
-
-// Crossfade between characters
-void run_fade_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
-}
+// #############################################################################################
+// Keyframe transitions
+//
+// Every transition is a table of tracks. A track animates one property (see
+// transition_properties in constants.h) of either the incoming or the outgoing character
+// through a handful of keyframes, and run_character_transitions() evaluates every track of the
+// selected table with the same interpolator. Properties without a track are left alone.
+//
+// Keyframe times are in TRANSITION_KEYFRAME_STEPS steps from the start (0) to the end of the
+// transition, and values are linearly interpolated between keyframes. Two keyframes at the same
+// time make a hard cut: the later one applies from that point on.
+//
+// The built in transitions are constant tables, and TRANSITION_CUSTOM_A-D can be uploaded over
+// the chain one track at a time with COM_SET_TRANSITION_TRACK. Each track is written to the CPU
+// core's copy of the custom transitions, which COM_SAVE_STORAGE writes to LittleFS so they're
+// restored on boot, and queued for the GPU core's copy through the render command ring
+// (render_state.h). A show() sent after an upload therefore always runs the new tracks.
+
+#define TRANSITION_KEYFRAME_STEPS 240     // Divides evenly into halves, thirds, quarters, etc.
+#define TRANSITION_MAX_CUSTOM_TRACKS 12   // Every property of both characters
+#define NUM_CUSTOM_TRANSITIONS (NUM_TRANSITIONS - TRANSITION_CUSTOM_A)
+
+#define TRANSITION_FILE "/TRANSITIONS.BIN"
+
+enum transition_slots {
+  TRANSITION_INCOMING,  // The character being transitioned to
+  TRANSITION_OUTGOING,  // The character on screen when the transition started
+};
+
+struct transition_track {
+  uint8_t SLOT;
+  uint8_t PROPERTY;
+  uint8_t NUM_KEYFRAMES;
+  const transition_keyframe* KEYFRAMES;
+};
+
+struct transition_table {
+  uint8_t NUM_TRACKS;
+  const transition_track* TRACKS;
+};
+
+// An uploaded transition, see custom_transition_track in constants.h
+struct custom_transition {
+  uint8_t NUM_TRACKS;
+  custom_transition_track TRACKS[TRANSITION_MAX_CUSTOM_TRACKS];
+};
+
+#define KEYFRAME_TIME(t) uint8_t((t) * TRANSITION_KEYFRAME_STEPS)
+#define TRANSITION_TRACK(slot, property, keyframes) { slot, property, sizeof(keyframes) / sizeof(transition_keyframe), keyframes }
+#define TRANSITION_TABLE(tracks) { sizeof(tracks) / sizeof(transition_track), tracks }
+
+// Keyframes shared by the built in transitions -----------------------------------------------
+const transition_keyframe KEYFRAMES_RAMP_UP[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), 1.0 } };
+const transition_keyframe KEYFRAMES_RAMP_DOWN[] = { { KEYFRAME_TIME(0.0), 1.0 }, { KEYFRAME_TIME(1.0), 0.0 } };
+const transition_keyframe KEYFRAMES_ON[] = { { KEYFRAME_TIME(0.0), 1.0 } };
+
+// Hard cut from one character to the other halfway through
+const transition_keyframe KEYFRAMES_CUT_IN[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(0.5), 0.0 }, { KEYFRAME_TIME(0.5), 1.0 } };
+const transition_keyframe KEYFRAMES_CUT_OUT[] = { { KEYFRAME_TIME(0.0), 1.0 }, { KEYFRAME_TIME(0.5), 1.0 }, { KEYFRAME_TIME(0.5), 0.0 } };
+
+// Down to nothing and back up again, halfway through
+const transition_keyframe KEYFRAMES_DIP[] = { { KEYFRAME_TIME(0.0), 1.0 }, { KEYFRAME_TIME(0.5), 0.0 }, { KEYFRAME_TIME(1.0), 1.0 } };
 
 // Fade to black between characters
-void run_fade_out_transition(){
-  float opacity_a = 0.0;
-  float opacity_b = 0.0;
+const transition_keyframe KEYFRAMES_FADE_OUT_IN[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(0.5), 0.0 }, { KEYFRAME_TIME(1.0), 1.0 } };
+const transition_keyframe KEYFRAMES_FADE_OUT_OUT[] = { { KEYFRAME_TIME(0.0), 1.0 }, { KEYFRAME_TIME(0.5), 0.0 }, { KEYFRAME_TIME(1.0), 0.0 } };
+
+// Rotations, in degrees
+const transition_keyframe KEYFRAMES_SPIN_LEFT_IN[] = { { KEYFRAME_TIME(0.0), 360.0 }, { KEYFRAME_TIME(1.0), 720.0 } };
+const transition_keyframe KEYFRAMES_SPIN_LEFT_OUT[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), 360.0 } };
+const transition_keyframe KEYFRAMES_SPIN_RIGHT_IN[] = { { KEYFRAME_TIME(0.0), -360.0 }, { KEYFRAME_TIME(1.0), -720.0 } };
+const transition_keyframe KEYFRAMES_SPIN_RIGHT_OUT[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), -360.0 } };
+const transition_keyframe KEYFRAMES_SPIN_LEFT_HALF_IN[] = { { KEYFRAME_TIME(0.0), 180.0 }, { KEYFRAME_TIME(1.0), 360.0 } };
+const transition_keyframe KEYFRAMES_SPIN_LEFT_HALF_OUT[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), 180.0 } };
+const transition_keyframe KEYFRAMES_SPIN_RIGHT_HALF_IN[] = { { KEYFRAME_TIME(0.0), -180.0 }, { KEYFRAME_TIME(1.0), -360.0 } };
+const transition_keyframe KEYFRAMES_SPIN_RIGHT_HALF_OUT[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), -180.0 } };
+
+// Positions, in LEDs
+const transition_keyframe KEYFRAMES_FROM_BELOW[] = { { KEYFRAME_TIME(0.0), -17.0 }, { KEYFRAME_TIME(1.0), 0.0 } };
+const transition_keyframe KEYFRAMES_TO_ABOVE[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), 17.0 } };
+const transition_keyframe KEYFRAMES_FROM_ABOVE[] = { { KEYFRAME_TIME(0.0), 17.0 }, { KEYFRAME_TIME(1.0), 0.0 } };
+const transition_keyframe KEYFRAMES_TO_BELOW[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), -17.0 } };
+const transition_keyframe KEYFRAMES_FROM_RIGHT[] = { { KEYFRAME_TIME(0.0), 12.0 }, { KEYFRAME_TIME(1.0), 0.0 } };
+const transition_keyframe KEYFRAMES_TO_LEFT[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), -12.0 } };
+const transition_keyframe KEYFRAMES_FROM_LEFT[] = { { KEYFRAME_TIME(0.0), -12.0 }, { KEYFRAME_TIME(1.0), 0.0 } };
+const transition_keyframe KEYFRAMES_TO_RIGHT[] = { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), 12.0 } };
+
+// Built in transitions -----------------------------------------------------------------------
+
+// Crossfade between characters (TRANSITION_INSTANT is the same, with the progress jumping to 1.0)
+const transition_track TRACKS_FADE[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+};
 
-  if(system_state_transition_progress_shaped < 0.5){
-    opacity_a = 0.0;
-    opacity_b = 1.0;
-  }
-  else{
-    opacity_a = 1.0;
-    opacity_b = 0.0;
-  }
+// Fade to black between characters
+const transition_track TRACKS_FADE_OUT[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_FADE_OUT_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_FADE_OUT_OUT),
+};
 
-  float fade_val = 1.0-saw_to_tri(system_state_transition_progress_shaped);
+// Flip character horizontally to reveal new character
+const transition_track TRACKS_FLIP_HORIZONTAL[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_CUT_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_CUT_OUT),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_SCALE_X, KEYFRAMES_DIP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_SCALE_X, KEYFRAMES_DIP),
+};
 
-  CHARACTER_STATE[!current_character_state].OPACITY = opacity_a * fade_val;
-  CHARACTER_STATE[current_character_state].OPACITY  = opacity_b * fade_val;
-}
+// Flip character vertically to reveal new character
+const transition_track TRACKS_FLIP_VERTICAL[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_CUT_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_CUT_OUT),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_SCALE_Y, KEYFRAMES_DIP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_SCALE_Y, KEYFRAMES_DIP),
+};
 
 // Spin 360 left during transition
-void run_spin_left_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
-
-  CHARACTER_STATE[!current_character_state].ROTATION =  1.0 * (360+360*system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].ROTATION  =  1.0 * (360*system_state_transition_progress_shaped);
-}
+const transition_track TRACKS_SPIN_LEFT[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_ROTATION, KEYFRAMES_SPIN_LEFT_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_ROTATION, KEYFRAMES_SPIN_LEFT_OUT),
+};
 
 // Spin 360 right during transition
-void run_spin_right_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
-
-  CHARACTER_STATE[!current_character_state].ROTATION = -1.0 * (360+360*system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].ROTATION  = -1.0 * (360*system_state_transition_progress_shaped);
-}
+const transition_track TRACKS_SPIN_RIGHT[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_ROTATION, KEYFRAMES_SPIN_RIGHT_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_ROTATION, KEYFRAMES_SPIN_RIGHT_OUT),
+};
 
 // Spin 180 left during transition
-void run_spin_left_half_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
-
-  CHARACTER_STATE[!current_character_state].ROTATION =  1.0 * (180+180*system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].ROTATION  =  1.0 * (180*system_state_transition_progress_shaped);
-}
+const transition_track TRACKS_SPIN_LEFT_HALF[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_ROTATION, KEYFRAMES_SPIN_LEFT_HALF_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_ROTATION, KEYFRAMES_SPIN_LEFT_HALF_OUT),
+};
 
 // Spin 180 right during transition
-void run_spin_right_half_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
+const transition_track TRACKS_SPIN_RIGHT_HALF[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_ROTATION, KEYFRAMES_SPIN_RIGHT_HALF_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_ROTATION, KEYFRAMES_SPIN_RIGHT_HALF_OUT),
+};
 
-  CHARACTER_STATE[!current_character_state].ROTATION = -1.0 * (180+180*system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].ROTATION  = -1.0 * (180*system_state_transition_progress_shaped);
-}
+// Shrink old character to point, swap the characters, then scale back up during transitions
+const transition_track TRACKS_SHRINK[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_CUT_IN),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_CUT_OUT),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_SCALE_X, KEYFRAMES_DIP),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_SCALE_Y, KEYFRAMES_DIP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_SCALE_X, KEYFRAMES_DIP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_SCALE_Y, KEYFRAMES_DIP),
+};
 
 // Scroll new character up into view
-void run_push_up_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
-
-  CHARACTER_STATE[!current_character_state].POSITION.y = -17.0 * (1.0-system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].POSITION.y  =  17.0 * (system_state_transition_progress_shaped);
-}
+const transition_track TRACKS_PUSH_UP[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_POSITION_Y, KEYFRAMES_FROM_BELOW),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_POSITION_Y, KEYFRAMES_TO_ABOVE),
+};
 
 // Scroll new character down into view
-void run_push_down_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = system_state_transition_progress_shaped;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0 - system_state_transition_progress_shaped;
-
-  CHARACTER_STATE[!current_character_state].POSITION.y =  17.0 * (1.0-system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].POSITION.y  = -17.0 * (system_state_transition_progress_shaped);
-}
+const transition_track TRACKS_PUSH_DOWN[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_RAMP_UP),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_RAMP_DOWN),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_POSITION_Y, KEYFRAMES_FROM_ABOVE),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_POSITION_Y, KEYFRAMES_TO_BELOW),
+};
 
 // Scroll new character left into view
-void run_push_left_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = 1.0;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0;
-
-  CHARACTER_STATE[!current_character_state].POSITION.x =  12.0 * (1.0-system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].POSITION.x  = -12.0 * (system_state_transition_progress_shaped);
-}
+const transition_track TRACKS_PUSH_LEFT[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_ON),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_ON),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_POSITION_X, KEYFRAMES_FROM_RIGHT),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_POSITION_X, KEYFRAMES_TO_LEFT),
+};
 
 // Scroll new character right into view
-void run_push_right_transition(){
-  CHARACTER_STATE[!current_character_state].OPACITY = 1.0;
-  CHARACTER_STATE[current_character_state].OPACITY = 1.0;
+const transition_track TRACKS_PUSH_RIGHT[] = {
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_OPACITY, KEYFRAMES_ON),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_OPACITY, KEYFRAMES_ON),
+  TRANSITION_TRACK(TRANSITION_INCOMING, TRANSITION_POSITION_X, KEYFRAMES_FROM_LEFT),
+  TRANSITION_TRACK(TRANSITION_OUTGOING, TRANSITION_POSITION_X, KEYFRAMES_TO_RIGHT),
+};
+
+// Indexed by transition type, in the order of the transitions enum in constants.h
+const transition_table transition_tables[TRANSITION_CUSTOM_A] = {
+  TRANSITION_TABLE(TRACKS_FADE),             // TRANSITION_INSTANT
+  TRANSITION_TABLE(TRACKS_FADE),             // TRANSITION_FADE
+  TRANSITION_TABLE(TRACKS_FADE_OUT),         // TRANSITION_FADE_OUT
+  TRANSITION_TABLE(TRACKS_FLIP_HORIZONTAL),  // TRANSITION_FLIP_HORIZONTAL
+  TRANSITION_TABLE(TRACKS_FLIP_VERTICAL),    // TRANSITION_FLIP_VERTICAL
+  TRANSITION_TABLE(TRACKS_SPIN_LEFT),        // TRANSITION_SPIN_LEFT
+  TRANSITION_TABLE(TRACKS_SPIN_RIGHT),       // TRANSITION_SPIN_RIGHT
+  TRANSITION_TABLE(TRACKS_SPIN_LEFT_HALF),   // TRANSITION_SPIN_LEFT_HALF
+  TRANSITION_TABLE(TRACKS_SPIN_RIGHT_HALF),  // TRANSITION_SPIN_RIGHT_HALF
+  TRANSITION_TABLE(TRACKS_SHRINK),           // TRANSITION_SHRINK
+  TRANSITION_TABLE(TRACKS_PUSH_UP),          // TRANSITION_PUSH_UP
+  TRANSITION_TABLE(TRACKS_PUSH_DOWN),        // TRANSITION_PUSH_DOWN
+  TRANSITION_TABLE(TRACKS_PUSH_LEFT),        // TRANSITION_PUSH_LEFT
+  TRANSITION_TABLE(TRACKS_PUSH_RIGHT),       // TRANSITION_PUSH_RIGHT
+};
+
+// Uploaded transitions -----------------------------------------------------------------------
+custom_transition custom_transitions[NUM_CUSTOM_TRANSITIONS];         // Only used by the GPU core
+custom_transition custom_transitions_staged[NUM_CUSTOM_TRANSITIONS];  // Only used by the CPU core, saved to LittleFS
+
+// Fixed point scale of each property's keyframe values in COM_SET_TRANSITION_TRACK packets
+const float transition_property_steps[NUM_TRANSITION_PROPERTIES] = {
+  1000.0,  // TRANSITION_OPACITY
+  100.0,   // TRANSITION_POSITION_X
+  100.0,   // TRANSITION_POSITION_Y
+  1000.0,  // TRANSITION_SCALE_X
+  1000.0,  // TRANSITION_SCALE_Y
+  10.0,    // TRANSITION_ROTATION
+};
+
+// #############################################################################################
+// Get the value of a track at (progress), 0.0-1.0 through the transition
+float evaluate_keyframes(const transition_keyframe* keyframes, uint8_t num_keyframes, float progress) {
+  if (num_keyframes == 0) {
+    return 0.0;
+  }
 
-  CHARACTER_STATE[!current_character_state].POSITION.x = -12.0 * (1.0-system_state_transition_progress_shaped);
-  CHARACTER_STATE[current_character_state].POSITION.x  =  12.0 * (system_state_transition_progress_shaped);
-}
+  float time = progress * TRANSITION_KEYFRAME_STEPS;
 
-// Shrink old character to point, swap the characters, then scale back up during transitions
-void run_shrink_transition(){
-  if(system_state_transition_progress_shaped < 0.5){
-    CHARACTER_STATE[!current_character_state].OPACITY = 0.0;
-    CHARACTER_STATE[current_character_state].OPACITY  = 1.0;
+  // Find the last keyframe at or before (time), later keyframes win ties so cuts work
+  uint8_t index = 0;
+  while (index + 1 < num_keyframes && keyframes[index + 1].TIME <= time) {
+    index++;
   }
-  else{
-    CHARACTER_STATE[!current_character_state].OPACITY = 1.0;
-    CHARACTER_STATE[current_character_state].OPACITY  = 0.0;
+
+  if (index + 1 >= num_keyframes || time <= keyframes[index].TIME) {
+    return keyframes[index].VALUE;
   }
 
-  float shrink_val = 1.0-saw_to_tri(system_state_transition_progress_shaped);
+  const transition_keyframe& a = keyframes[index];
+  const transition_keyframe& b = keyframes[index + 1];
 
-  CHARACTER_STATE[!current_character_state].SCALE.x = shrink_val;
-  CHARACTER_STATE[!current_character_state].SCALE.y = shrink_val;
+  return interpolate_float(a.VALUE, b.VALUE, (time - a.TIME) / float(b.TIME - a.TIME));
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Write a property of a character state
+void set_transition_property(character_state& state, uint8_t property, float value) {
+  if (property == TRANSITION_OPACITY) {
+    state.OPACITY = value;
+  } else if (property == TRANSITION_POSITION_X) {
+    state.POSITION.x = value;
+  } else if (property == TRANSITION_POSITION_Y) {
+    state.POSITION.y = value;
+  } else if (property == TRANSITION_SCALE_X) {
+    state.SCALE.x = value;
+  } else if (property == TRANSITION_SCALE_Y) {
+    state.SCALE.y = value;
+  } else if (property == TRANSITION_ROTATION) {
+    state.ROTATION = value;
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Animate both character states with the type of the transition last started
+void run_character_transitions() {
+  uint8_t transition_type = active_transition_type;
+  float progress = system_state_transition_progress_shaped;
+
+  character_state* slots[2] = {
+    &CHARACTER_STATE[!current_character_state],  // TRANSITION_INCOMING
+    &CHARACTER_STATE[current_character_state],   // TRANSITION_OUTGOING
+  };
+
+  if (transition_type < TRANSITION_CUSTOM_A) {
+    const transition_table& table = transition_tables[transition_type];
+    for (uint8_t i = 0; i < table.NUM_TRACKS; i++) {
+      const transition_track& track = table.TRACKS[i];
+      set_transition_property(*slots[track.SLOT], track.PROPERTY, evaluate_keyframes(track.KEYFRAMES, track.NUM_KEYFRAMES, progress));
+    }
+  }
+  else if (transition_type < NUM_TRANSITIONS) {
+    const custom_transition& table = custom_transitions[transition_type - TRANSITION_CUSTOM_A];
+    for (uint8_t i = 0; i < table.NUM_TRACKS; i++) {
+      const custom_transition_track& track = table.TRACKS[i];
+      set_transition_property(*slots[track.SLOT], track.PROPERTY, evaluate_keyframes(track.KEYFRAMES, track.NUM_KEYFRAMES, progress));
+    }
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Reset every custom transition to a crossfade, before any are loaded from LittleFS. Called
+// before the GPU core starts drawing, so both copies can simply be written.
+void init_custom_transitions() {
+  for (uint8_t i = 0; i < NUM_CUSTOM_TRANSITIONS; i++) {
+    custom_transition& transition = custom_transitions_staged[i];
+    memset(&transition, 0, sizeof(custom_transition));
 
-  CHARACTER_STATE[current_character_state].SCALE.x = shrink_val;
-  CHARACTER_STATE[current_character_state].SCALE.y = shrink_val;
+    transition.NUM_TRACKS = 2;
+    transition.TRACKS[0] = { TRANSITION_INCOMING, TRANSITION_OPACITY, 2, { { KEYFRAME_TIME(0.0), 0.0 }, { KEYFRAME_TIME(1.0), 1.0 } } };
+    transition.TRACKS[1] = { TRANSITION_OUTGOING, TRANSITION_OPACITY, 2, { { KEYFRAME_TIME(0.0), 1.0 }, { KEYFRAME_TIME(1.0), 0.0 } } };
+
+    memcpy(&custom_transitions[i], &transition, sizeof(custom_transition));
+  }
 }
+// #############################################################################################
 
-// Flip character horizontally to reveal new character
-void run_flip_horizontal_transition(){
-  if(system_state_transition_progress_shaped < 0.5){
-    CHARACTER_STATE[!current_character_state].OPACITY = 0.0;
-    CHARACTER_STATE[current_character_state].OPACITY  = 1.0;
+
+// #############################################################################################
+// Replace track (track_index) of (transition) with (track), making it the last track of the
+// transition
+void write_custom_transition_track(custom_transition& transition, uint8_t track_index, const custom_transition_track& track) {
+  memcpy(&transition.TRACKS[track_index], &track, sizeof(custom_transition_track));
+  transition.NUM_TRACKS = track_index + 1;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: replace one track of a custom transition, from a COM_SET_TRANSITION_TRACK packet.
+// Writing track (n) also makes it the last one, so transitions are uploaded from track 0 up.
+// (data) holds TIME and a signed 16-bit fixed point VALUE for every keyframe, see
+// transition_property_steps[].
+void set_custom_transition_track(uint8_t transition_type, uint8_t track_index, uint8_t slot, uint8_t property, uint8_t num_keyframes, const uint8_t* data) {
+  if (transition_type < TRANSITION_CUSTOM_A || transition_type >= NUM_TRANSITIONS) {
+    return;
   }
-  else{
-    CHARACTER_STATE[!current_character_state].OPACITY = 1.0;
-    CHARACTER_STATE[current_character_state].OPACITY  = 0.0;
+
+  if (track_index >= TRANSITION_MAX_CUSTOM_TRACKS || slot > TRANSITION_OUTGOING || property >= NUM_TRANSITION_PROPERTIES) {
+    return;
   }
 
-  float flip_val = 1.0-saw_to_tri(system_state_transition_progress_shaped);
+  if (num_keyframes > TRANSITION_MAX_KEYFRAMES) {
+    num_keyframes = TRANSITION_MAX_KEYFRAMES;
+  }
 
-  CHARACTER_STATE[!current_character_state].SCALE.x = flip_val;
-  //CHARACTER_STATE[!current_character_state].SCALE.y = flip_val;
+  render_command command;
+  command.TYPE = RENDER_COMMAND_SET_TRANSITION_TRACK;
+  command.TRANSITION = transition_type - TRANSITION_CUSTOM_A;
+  command.TRACK_INDEX = track_index;
+
+  custom_transition_track& track = command.TRACK;
+  memset(&track, 0, sizeof(custom_transition_track));
+  track.SLOT = slot;
+  track.PROPERTY = property;
+  track.NUM_KEYFRAMES = num_keyframes;
+  for (uint8_t i = 0; i < num_keyframes; i++) {
+    track.KEYFRAMES[i].TIME = data[i * 3 + 0];
+    track.KEYFRAMES[i].VALUE = int16_t((data[i * 3 + 1] << 8) + data[i * 3 + 2]) / transition_property_steps[property];
+  }
 
-  CHARACTER_STATE[current_character_state].SCALE.x = flip_val;
-  //CHARACTER_STATE[current_character_state].SCALE.y = flip_val;
+  write_custom_transition_track(custom_transitions_staged[command.TRANSITION], track_index, track);
+  push_render_command(command);
 }
+// #############################################################################################
 
-// Flip character vertically to reveal new character
-void run_flip_vertical_transition(){
-  if(system_state_transition_progress_shaped < 0.5){
-    CHARACTER_STATE[!current_character_state].OPACITY = 0.0;
-    CHARACTER_STATE[current_character_state].OPACITY  = 1.0;
+
+// #############################################################################################
+// GPU core: apply a track queued by set_custom_transition_track(), called by
+// apply_render_state()
+void apply_custom_transition_track(const render_command& command) {
+  write_custom_transition_track(custom_transitions[command.TRANSITION], command.TRACK_INDEX, command.TRACK);
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// CPU core: load the custom transitions saved by save_custom_transitions(), if there are any.
+// Called during init_system(), before the GPU core starts drawing.
+void load_custom_transitions() {
+  File file = LittleFS.open(TRANSITION_FILE, "r");
+  if (!file) {
+    return;  // Nothing uploaded yet
   }
-  else{
-    CHARACTER_STATE[!current_character_state].OPACITY = 1.0;
-    CHARACTER_STATE[current_character_state].OPACITY  = 0.0;
+
+  if (file.size() == sizeof(custom_transitions_staged)) {
+    file.read((uint8_t*)custom_transitions_staged, sizeof(custom_transitions_staged));
+
+    // Drop anything out of range rather than trusting the file
+    for (uint8_t i = 0; i < NUM_CUSTOM_TRANSITIONS; i++) {
+      custom_transition& transition = custom_transitions_staged[i];
+      if (transition.NUM_TRACKS > TRANSITION_MAX_CUSTOM_TRACKS) {
+        transition.NUM_TRACKS = 0;
+      }
+
+      for (uint8_t t = 0; t < transition.NUM_TRACKS; t++) {
+        custom_transition_track& track = transition.TRACKS[t];
+        if (track.SLOT > TRANSITION_OUTGOING || track.PROPERTY >= NUM_TRANSITION_PROPERTIES || track.NUM_KEYFRAMES > TRANSITION_MAX_KEYFRAMES) {
+          transition.NUM_TRACKS = t;
+          break;
+        }
+      }
+
+      memcpy(&custom_transitions[i], &transition, sizeof(custom_transition));
+    }
   }
 
-  float flip_val = 1.0-saw_to_tri(system_state_transition_progress_shaped);
+  file.close();
+}
+// #############################################################################################
+
 
-  //CHARACTER_STATE[!current_character_state].SCALE.x = flip_val;
-  CHARACTER_STATE[!current_character_state].SCALE.y = flip_val;
+// #############################################################################################
+// CPU core: write the custom transitions to LittleFS, called alongside save_storage()
+void save_custom_transitions() {
+  File file = LittleFS.open(TRANSITION_FILE, "w+");
+  if (!file) {
+    return;
+  }
 
-  //CHARACTER_STATE[current_character_state].SCALE.x = flip_val;
-  CHARACTER_STATE[current_character_state].SCALE.y = flip_val;
-}
\ No newline at end of file
+  file.write((const uint8_t*)custom_transitions_staged, sizeof(custom_transitions_staged));
+  file.close();
+}
+// #############################################################################################
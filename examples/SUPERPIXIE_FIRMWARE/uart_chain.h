@@ -2,6 +2,8 @@
 #include "soc/rtc_cntl_reg.h"
 #include "esp_system.h"     // For esp_restart
 
+extern bool telemetry_owns_chain_right();
+
 #define DEFAULT_CHAIN_BAUD (9600)
 
 #define SERIAL_0_RX_GPIO (3)
@@ -25,6 +27,7 @@
 
 #define UPSTREAM (1)
 #define DOWNSTREAM (0)
+#define TIMELINE_SOURCE (2)  // Not a direction, commands replayed by run_timeline() in timeline.h
 
 uint8_t NULL_DATA[1] = { 0 };
 
@@ -48,7 +51,7 @@ bool propagation_queued = false;
 // Holds incoming data
 uint8_t sync_buffer[2][4];
 uint8_t packet_buffer[2][128];
-uint8_t packet_data[2][64];
+uint8_t packet_data[3][64];  // One per direction, and one for TIMELINE_SOURCE
 uint8_t packet_buffer_index[2] = { 0, 0 };
 bool packet_started[2] = { false, false };
 
@@ -115,7 +118,9 @@ void check_data() {
       set_display_color( error_color );
       set_backlight_color( error_color );
 
-      frame_blending_amount = 0.0;
+      RENDER_STATE_STAGED.FRAME_BLENDING_AMOUNT = 0.0;
+      render_state_dirty = true;
+
       set_transition_type( TRANSITION_FADE );
       set_transition_time_ms( 250 );
       set_new_character( '?' );
@@ -243,7 +248,7 @@ void send_packet(uint8_t direction, uint8_t command_type, uint8_t destination_ad
   if (direction == UPSTREAM) {
     chain_left.write(packet_temp, total_packet_bytes);
     chain_left.flush();
-  } else if (direction == DOWNSTREAM) {
+  } else if (direction == DOWNSTREAM && telemetry_owns_chain_right() == false) {
     chain_right.write(packet_temp, total_packet_bytes);
     chain_right.flush();
   }
@@ -361,6 +366,28 @@ void init_packet(uint8_t from_direction) {
   packet_started[from_direction] = true;
 }
 
+// Send the min/avg/p99 of every profiled stage to the commander, as many packets as it takes
+void send_profile() {
+  for (uint8_t first_stage = 0; first_stage < NUM_PROFILE_STAGES; first_stage += PROFILE_STAGES_PER_PACKET) {
+    uint8_t num_stages = NUM_PROFILE_STAGES - first_stage;
+    if (num_stages > PROFILE_STAGES_PER_PACKET) {
+      num_stages = PROFILE_STAGES_PER_PACKET;
+    }
+
+    uint8_t profile_data[3 + PROFILE_STAGES_PER_PACKET * 6] = { first_stage, num_stages, NUM_PROFILE_STAGES };
+    for (uint8_t i = 0; i < num_stages; i++) {
+      get_profile_stage(first_stage + i, &profile_data[3 + i * 6]);
+    }
+
+    send_packet(UPSTREAM, COM_FPS_RESPONSE, ADDRESS_COMMANDER, 3 + num_stages * 6, profile_data);
+  }
+}
+
+
+// Defined in timeline.h, which is included after this file
+extern void add_timeline_entry(const uint8_t* data, uint8_t data_length);
+extern void control_timeline(const uint8_t* data, uint8_t data_length);
+
 void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t packet_id, uint8_t command_type, uint8_t data_length) {
   if(from_direction == UPSTREAM){
     upstream_packets_receieved++;
@@ -442,7 +469,8 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
 
   else if (command_type == COM_SET_FRAME_BLENDING) {
     packet_execution_flag = true;
-    frame_blending_amount = packet_data[from_direction][0] / 255.0;
+    RENDER_STATE_STAGED.FRAME_BLENDING_AMOUNT = packet_data[from_direction][0] / 255.0;
+    render_state_dirty = true;
   }
 
   else if (command_type == COM_SET_BRIGHTNESS) {
@@ -482,15 +510,11 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
   }
 
   else if (command_type == COM_SET_CHARACTER) {
-    freeze_led_image = true;
-
     packet_execution_flag = true;
     char new_character = packet_data[from_direction][0];
     set_new_character( new_character );
     //debug("NEW CHARACTER: ");
     //debugln(new_character);
-
-    freeze_led_image = false;
   }
 
   else if (command_type == COM_START_BUS_MODE) {
@@ -512,7 +536,8 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
 
   else if(command_type == COM_SET_DEBUG_OVERLAY_OPACITY){
     packet_execution_flag = true;
-    debug_led_opacity = packet_data[from_direction][0] / 255.0;
+    RENDER_STATE_STAGED.DEBUG_LED_OPACITY = packet_data[from_direction][0] / 255.0;
+    render_state_dirty = true;
   }
 
   else if(command_type == COM_SET_DISPLAY_COLORS){
@@ -549,7 +574,8 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
   else if(command_type == COM_SET_TRANSITION_INTERPOLATION){
     packet_execution_flag = true;
     uint8_t interpolation_type = packet_data[from_direction][0];
-    SYSTEM_STATE.TRANSITION_INTERPOLATION = interpolation_type;
+    RENDER_STATE_STAGED.TRANSITION_INTERPOLATION = interpolation_type;
+    render_state_dirty = true;
 
     //debug("NEW TRANSITION INTERPOLATION: ");
     //debugln(interpolation_type);
@@ -558,7 +584,8 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
   else if(command_type == COM_SET_TOUCH_GLOW_POSITION){
     packet_execution_flag = true;
     uint8_t position = packet_data[from_direction][0];
-    SYSTEM_STATE.TOUCH_GLOW_POSITION = position;
+    RENDER_STATE_STAGED.TOUCH_GLOW_POSITION = position;
+    render_state_dirty = true;
 
     //debug("NEW TOUCH GLOW POSITION: ");
     //debugln(position);
@@ -566,15 +593,16 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
 
   else if(command_type == COM_SET_TOUCH_GLOW_COLOR){
     packet_execution_flag = true;
-    SYSTEM_STATE.TOUCH_COLOR = { packet_data[from_direction][0] / 255.0F, packet_data[from_direction][1] / 255.0F, packet_data[from_direction][2] / 255.0F };
+    RENDER_STATE_STAGED.TOUCH_COLOR = { packet_data[from_direction][0] / 255.0F, packet_data[from_direction][1] / 255.0F, packet_data[from_direction][2] / 255.0F };
+    render_state_dirty = true;
   }
 
   else if(command_type == COM_READ_TOUCH){
     packet_execution_flag = true;
 
     uint8_t touch_data[2] = { 
-      get_byte_from_16_bit(SYSTEM_STATE.TOUCH_VALUE, HIGH),
-      get_byte_from_16_bit(SYSTEM_STATE.TOUCH_VALUE, LOW),
+      get_byte_from_16_bit(RENDER_STATE_STAGED.TOUCH_VALUE, HIGH),
+      get_byte_from_16_bit(RENDER_STATE_STAGED.TOUCH_VALUE, LOW),
     };
 
     send_packet(UPSTREAM, COM_READ_TOUCH_RESPONSE, ADDRESS_COMMANDER, 2, touch_data);
@@ -586,10 +614,10 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
     uint8_t touch_type = packet_data[from_direction][0];
 
     if(touch_type == HIGH){
-      STORAGE.TOUCH_HIGH_LEVEL = SYSTEM_STATE.TOUCH_VALUE-5;
+      STORAGE.TOUCH_HIGH_LEVEL = RENDER_STATE_STAGED.TOUCH_VALUE-5;
     }
     else if(touch_type == LOW){
-      STORAGE.TOUCH_LOW_LEVEL = SYSTEM_STATE.TOUCH_VALUE+5;
+      STORAGE.TOUCH_LOW_LEVEL = RENDER_STATE_STAGED.TOUCH_VALUE+5;
     }
 
     //save_storage();
@@ -606,6 +634,115 @@ void execute_packet(uint8_t from_direction, uint8_t origin_address, uint16_t pac
     packet_execution_flag = true;
 
     save_storage();
+    save_custom_transitions();
+  }
+
+  else if(command_type == COM_SET_GAMMA_CURVE){
+    packet_execution_flag = true;
+
+    uint8_t curve = packet_data[from_direction][0];
+    uint16_t exponent_x100 = ( packet_data[from_direction][1] << 8 ) + packet_data[from_direction][2];
+
+    set_gamma_curve( curve, exponent_x100 / 100.0 );
+  }
+
+  else if(command_type == COM_SET_DITHER_MODE){
+    packet_execution_flag = true;
+
+    uint8_t mode = packet_data[from_direction][0];
+    uint8_t min_flicker_hz = packet_data[from_direction][1];
+
+    set_dither_mode( mode, min_flicker_hz );
+  }
+
+  else if(command_type == COM_SPAWN_EFFECT){
+    packet_execution_flag = true;
+
+    // Positions and widths are signed hundredths of an LED, times are in milliseconds
+    uint8_t* data = packet_data[from_direction];
+
+    render_command command;
+    command.TYPE = RENDER_COMMAND_SPAWN_EFFECT;
+
+    effect_parameters& effect = command.EFFECT;
+    effect.TYPE = data[0];
+    effect.INTERPOLATION = data[1];
+    effect.COLOR_START = { data[2] / 255.0F, data[3] / 255.0F, data[4] / 255.0F };
+    effect.COLOR_END = { data[5] / 255.0F, data[6] / 255.0F, data[7] / 255.0F };
+    effect.POSITION_START = int16_t(( data[8] << 8 ) + data[9]) / 100.0;
+    effect.POSITION_END = int16_t(( data[10] << 8 ) + data[11]) / 100.0;
+    effect.WIDTH_START = int16_t(( data[12] << 8 ) + data[13]) / 100.0;
+    effect.WIDTH_END = int16_t(( data[14] << 8 ) + data[15]) / 100.0;
+    effect.OPACITY_START = data[16] / 255.0;
+    effect.OPACITY_END = data[17] / 255.0;
+    effect.DURATION_MS = ( data[18] << 8 ) + data[19];
+    effect.DELAY_MS = ( data[20] << 8 ) + data[21];
+
+    push_render_command(command);
+  }
+
+  else if(command_type == COM_SET_EASING_CURVE){
+    packet_execution_flag = true;
+
+    // Written to the curve by the GPU core, see set_easing_curve_points()
+    render_command command;
+    command.TYPE = RENDER_COMMAND_SET_EASING_POINTS;
+    command.EASING_SLOT = packet_data[from_direction][0];
+    command.FIRST_POINT = packet_data[from_direction][1];
+    command.NUM_POINTS = packet_data[from_direction][2];
+    if (command.NUM_POINTS > EASING_CUSTOM_POINTS_PER_PACKET) {
+      command.NUM_POINTS = EASING_CUSTOM_POINTS_PER_PACKET;
+    }
+    memcpy(command.POINTS, &packet_data[from_direction][3], command.NUM_POINTS);
+
+    push_render_command(command);
+  }
+
+  else if(command_type == COM_SET_TRANSITION_TRACK){
+    packet_execution_flag = true;
+
+    uint8_t* data = packet_data[from_direction];
+    set_custom_transition_track( data[0], data[1], data[2], data[3], data[4], &data[5] );
+  }
+
+  else if(command_type == COM_QUEUE_SEQUENCE){
+    packet_execution_flag = true;
+    queue_sequence_packet( packet_data[from_direction], data_length );
+  }
+
+  else if(command_type == COM_SET_MARQUEE){
+    packet_execution_flag = true;
+    set_marquee_packet( packet_data[from_direction], data_length, CHAIN_CONFIG.LOCAL_ADDRESS, CHAIN_CONFIG.CHAIN_LENGTH, CHAIN_CONFIG.BUS_MODE );
+  }
+
+  else if(command_type == COM_STREAM_FRAME){
+    packet_execution_flag = true;
+    receive_stream_fragment( packet_data[from_direction], data_length );
+  }
+
+  else if(command_type == COM_TIMELINE_ADD){
+    packet_execution_flag = true;
+    add_timeline_entry( packet_data[from_direction], data_length );
+  }
+
+  else if(command_type == COM_TIMELINE_CONTROL){
+    packet_execution_flag = true;
+    control_timeline( packet_data[from_direction], data_length );
+  }
+
+  else if(command_type == COM_GET_FPS){
+    packet_execution_flag = true;
+    send_profile();
+
+    // Optionally start counting again from the next frame
+    if (data_length > 0 && packet_data[from_direction][0] == 1) {
+      profile_reset_requested = true;
+    }
+  }
+
+  else if(command_type == COM_SET_CLOCK){
+    packet_execution_flag = true;
+    set_clock_packet( packet_data[from_direction], data_length, CHAIN_CONFIG.LOCAL_ADDRESS, CHAIN_CONFIG.BUS_MODE );
   }
 }
 
@@ -720,7 +857,7 @@ void parse_incoming_data_from(uint8_t from_direction) {
 
     if(CHAIN_CONFIG.PROPAGATION_MODE == true && DEBUG_MODE == false){
       tx_flag_right = true;
-      if(CHAIN_CONFIG.BUS_MODE == false){
+      if(CHAIN_CONFIG.BUS_MODE == false && telemetry_owns_chain_right() == false){
         chain_right.write(byte);
       }
     }
@@ -777,7 +914,7 @@ void parse_incoming_data_from(uint8_t from_direction) {
 
 
 void send_touch_event() {
-  uint8_t touch_data[1] = { SYSTEM_STATE.TOUCH_ACTIVE };
+  uint8_t touch_data[1] = { RENDER_STATE_STAGED.TOUCH_ACTIVE };
 
   //debug("SENDING TOUCH EVENT: ");
   //debugln(touch_data[0]);
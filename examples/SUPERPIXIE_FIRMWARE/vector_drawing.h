@@ -11,57 +11,54 @@ bool character_state_changed = false;
 uint8_t current_character_state = 0;
 //--------------------------------------------------------------------------------------------------
 
-// Line memory stores up to 128 line segments in two system states, useful for storing the
-// current and next character to be drawn, with line_count[] marking the number of lines loaded
-// into each half of line_memory.
-line line_memory[2][128];
-uint16_t line_count[2] = { 0 };
+// Line memory holds the current and next character to be drawn, as glyph meshes: shared vertices
+// plus pairs of vertex indices. The meshes themselves live in the glyph cache (glyph_cache.h),
+// and line_memory_glyph[] holds the cache entry behind each slot.
+glyph_mesh line_memory[2] = { { NULL, NULL, 0, 0, { 0.0, 0.0 }, { 0.0, 0.0 } }, { NULL, NULL, 0, 0, { 0.0, 0.0 }, { 0.0, 0.0 } } };
+int8_t line_memory_glyph[2] = { GLYPH_CACHE_NONE, GLYPH_CACHE_NONE };
+char line_memory_character[2] = { 0, 0 };
+
+#if GLYPH_RENDER_SDF == 1
+// Distance fields of the glyphs in line_memory[], rebuilt only when a slot's character changes
+glyph_distance_field line_memory_field[2];
+#endif
+
+// Value of display_color_map_serial each slot's layer was last composited with
+uint32_t character_layer_color_serial[2] = { 0, 0 };
+
+// Rasterizer statistics since boot, to see how much work culling saves
+uint32_t raster_lines_tested = 0;  // Lines of visible glyphs checked against the panel
+uint32_t raster_lines_drawn = 0;   // Lines that overlapped the panel and were rastered
+uint32_t raster_glyphs_culled = 0;  // Glyphs skipped whole, for being invisible or off the panel
+
+extern bool run_marquee();
+extern bool stream_active;
+
+// Scratch space for the vertices of the glyph being drawn, after scaling, rotation and offset
+vec2D transformed_vertices[FONT_MAX_GLYPH_VERTICES];
 
 
 // #############################################################################################
-// Using the vector currently defined in the [slot] of line_memory, offset its position, rotation,
-// scale and opacity before rastering it to the character mask passed in as draw_mask[][].
-void draw_vector_from_line_memory(uint8_t slot, float draw_mask[LEDS_X][LEDS_Y], vec2D pos, vec2D scale, float rotation, float opacity) {
+// Raster the line segments of (mesh) to draw_mask[][], after moving them with (transform). This
+// is the exact reference renderer, testing each pixel near a line against that line.
+void draw_glyph_segments(const glyph_mesh& mesh, float draw_mask[LEDS_X][LEDS_Y], const transform_2D& transform, float opacity) {
   const float line_segment_width = 1.0;
   const float line_segment_width_squared = line_segment_width * line_segment_width;
 
-  for (uint16_t line = 0; line < line_count[slot]; line++) {
-    float line_start_x = line_memory[slot][line].x1;
-    float line_start_y = line_memory[slot][line].y1;
-    float line_end_x = line_memory[slot][line].x2;
-    float line_end_y = line_memory[slot][line].y2;
-
-    if (scale.x != 1.0 || scale.y != 1.0) {
-      line_start_x *= scale.x;
-      line_end_x *= scale.x;
-      line_start_y *= scale.y;
-      line_end_y *= scale.y;
-    }
+  // Lines share vertices, so each one only needs to be transformed once
+  for (uint8_t i = 0; i < mesh.num_vertices; i++) {
+    float x = mesh.vertices[i].x;
+    float y = mesh.vertices[i].y;
 
-    float rotated_x1, rotated_y1, rotated_x2, rotated_y2;
-    rotation = fmod(rotation, 360.0);
-    if (rotation == 0.0000) {
-      // Preserve verts if no rotation needed
-      rotated_x1 = line_start_x;
-      rotated_y1 = line_start_y;
-      rotated_x2 = line_end_x;
-      rotated_y2 = line_end_y;
-    } else {
-      // Convert angle from degrees to radians
-      float angle_rad = rotation * M_PI / 180.0;
-      //angle_rad *= -1.0;
-
-      // Rotate verts (More computationally expensive)
-      rotated_x1 = line_start_x * cos(angle_rad) - line_start_y * sin(angle_rad);
-      rotated_y1 = line_start_x * sin(angle_rad) + line_start_y * cos(angle_rad);
-      rotated_x2 = line_end_x * cos(angle_rad) - line_end_y * sin(angle_rad);
-      rotated_y2 = line_end_x * sin(angle_rad) + line_end_y * cos(angle_rad);
-    }
+    transformed_vertices[i].x = transform.m00 * x + transform.m01 * y + transform.tx;
+    transformed_vertices[i].y = transform.m10 * x + transform.m11 * y + transform.ty;
+  }
 
-    line_start_x = rotated_x1 + pos.x + 3;
-    line_start_y = rotated_y1 + pos.y + 7;
-    line_end_x = rotated_x2 + pos.x + 3;
-    line_end_y = rotated_y2 + pos.y + 7;
+  for (uint8_t line = 0; line < mesh.num_lines; line++) {
+    float line_start_x = transformed_vertices[mesh.lines[line].start].x;
+    float line_start_y = transformed_vertices[mesh.lines[line].start].y;
+    float line_end_x = transformed_vertices[mesh.lines[line].end].x;
+    float line_end_y = transformed_vertices[mesh.lines[line].end].y;
 
     // Determine the minimum and maximum values for x and y coordinates
     float x_min = (line_start_x < line_end_x) ? line_start_x : line_end_x;
@@ -69,6 +66,15 @@ void draw_vector_from_line_memory(uint8_t slot, float draw_mask[LEDS_X][LEDS_Y],
     float y_min = (line_start_y < line_end_y) ? line_start_y : line_end_y;
     float y_max = (line_start_y > line_end_y) ? line_start_y : line_end_y;
 
+    raster_lines_tested++;
+
+    // Skip lines whose stroke can't reach the panel
+    if (x_max <= -line_segment_width || x_min >= LEDS_X - 1 + line_segment_width || y_max <= -line_segment_width || y_min >= LEDS_Y - 1 + line_segment_width) {
+      continue;
+    }
+
+    raster_lines_drawn++;
+
     for (int16_t x = x_min - 1; x <= x_max + 1; x++) {
       for (int16_t y = y_min - 1; y <= y_max + 1; y++) {
         if (x >= 0 && x < LEDS_X) {
@@ -96,59 +102,126 @@ void draw_vector_from_line_memory(uint8_t slot, float draw_mask[LEDS_X][LEDS_Y],
 
 
 // #############################################################################################
-// Load a vector from the compressed format in ascii.h into native floating point values
-// cached in line_memory[][] to be used by the rasterizer above
-void load_vector_to_line_memory(uint8_t slot, uint8_t* input_data, int16_t offset) {
-  const uint8_t header_length = 6;
+// Check whether a glyph's bounding box, moved by (transform), comes within a stroke's width of
+// the panel
+bool is_glyph_on_screen(const glyph_mesh& mesh, const transform_2D& transform) {
+  const float line_segment_width = 1.0;
 
-  int16_t num_bytes = (input_data[offset + 0] << 8) + input_data[offset + 1];
-  int16_t num_verts = (input_data[offset + 2] << 8) + input_data[offset + 3];
+  const vec2D corners[4] = {
+    { mesh.bounds_min.x, mesh.bounds_min.y },
+    { mesh.bounds_max.x, mesh.bounds_min.y },
+    { mesh.bounds_min.x, mesh.bounds_max.y },
+    { mesh.bounds_max.x, mesh.bounds_max.y },
+  };
+
+  float x_min = 0.0, x_max = 0.0, y_min = 0.0, y_max = 0.0;
+  for (uint8_t i = 0; i < 4; i++) {
+    float x = transform.m00 * corners[i].x + transform.m01 * corners[i].y + transform.tx;
+    float y = transform.m10 * corners[i].x + transform.m11 * corners[i].y + transform.ty;
+
+    if (i == 0 || x < x_min) { x_min = x; }
+    if (i == 0 || x > x_max) { x_max = x; }
+    if (i == 0 || y < y_min) { y_min = y; }
+    if (i == 0 || y > y_max) { y_max = y; }
+  }
 
-  uint16_t lines_start_offset = header_length + num_verts * 4;
+  return !(x_max <= -line_segment_width || x_min >= LEDS_X - 1 + line_segment_width || y_max <= -line_segment_width || y_min >= LEDS_Y - 1 + line_segment_width);
+}
+// #############################################################################################
 
-  for (int16_t i = lines_start_offset; i < num_bytes; i += 4) {
-    int16_t line_start = (input_data[offset + i + 0] << 8) + input_data[offset + i + 1];
-    int16_t line_end = (input_data[offset + i + 2] << 8) + input_data[offset + i + 3];
 
-    int16_t line_start_vertex_offset = header_length + (4 * line_start);
-    int16_t start_coord_x_int = (input_data[offset + line_start_vertex_offset + 0] << 8) + input_data[offset + line_start_vertex_offset + 1];
-    int16_t start_coord_y_int = (input_data[offset + line_start_vertex_offset + 2] << 8) + input_data[offset + line_start_vertex_offset + 3];
+// #############################################################################################
+// Using the vector currently defined in the [slot] of line_memory, offset its position, rotation,
+// scale and opacity before rastering it to the character mask passed in as draw_mask[][], or
+// reusing the mask from the raster cache (raster_cache.h). Returns false if the glyph was culled
+// without drawing anything.
+bool draw_vector_from_line_memory(uint8_t slot, float draw_mask[LEDS_X][LEDS_Y], vec2D pos, vec2D scale, float rotation, float opacity) {
+  const glyph_mesh& mesh = line_memory[slot];
+
+  if (opacity <= 0.0 || mesh.num_lines == 0) {
+    raster_glyphs_culled++;
+    return false;
+  }
+
+  // Snap the transform to the raster cache's grid, so cached and fresh masks look the same
+  raster_cache_key key = make_raster_cache_key(line_memory_character[slot], pos, scale, rotation);
+  get_raster_cache_transform(key, pos, scale, rotation);
 
-    int16_t line_end_vertex_offset = header_length + (4 * line_end);
-    int16_t end_coord_x_int = (input_data[offset + line_end_vertex_offset + 0] << 8) + input_data[offset + line_end_vertex_offset + 1];
-    int16_t end_coord_y_int = (input_data[offset + line_end_vertex_offset + 2] << 8) + input_data[offset + line_end_vertex_offset + 3];
+  // Glyphs are centered on the middle of the display, and the trig only happens once per draw
+  vec2D offset = { pos.x + 3, pos.y + 7 };
+  transform_2D transform = make_transform_2D(offset, scale, rotation);
 
-    float start_coord_x = start_coord_x_int / 100.0;
-    float start_coord_y = start_coord_y_int / 100.0;
+  // Pushed entirely off the panel
+  if (is_glyph_on_screen(mesh, transform) == false) {
+    raster_glyphs_culled++;
+    return false;
+  }
 
-    float end_coord_x = end_coord_x_int / 100.0;
-    float end_coord_y = end_coord_y_int / 100.0;
+  bool hit;
+  raster_cache_entry& cached = raster_cache[get_raster_cache_entry(key, hit)];
 
-    line_memory[slot][line_count[slot]].x1 = start_coord_x;
-    line_memory[slot][line_count[slot]].y1 = start_coord_y;
-    line_memory[slot][line_count[slot]].x2 = end_coord_x;
-    line_memory[slot][line_count[slot]].y2 = end_coord_y;
+  if (hit == false) {
+    // Raster at full opacity, the cached mask is scaled to the slot's opacity below
+#if GLYPH_RENDER_SDF == 1
+    // Squashed too far for the field to cover the stroke, fall back to the segments
+    if (draw_glyph_distance_field(line_memory_field[slot], cached.MASK, transform, 1.0) == false) {
+      draw_glyph_segments(mesh, cached.MASK, transform, 1.0);
+    }
+#else
+    draw_glyph_segments(mesh, cached.MASK, transform, 1.0);
+#endif
+  }
 
-    line_count[slot]++;
+  for (uint8_t x = 0; x < LEDS_X; x++) {
+    for (uint8_t y = 0; y < LEDS_Y; y++) {
+      float brightness = cached.MASK[x][y] * opacity;
+      if (brightness > draw_mask[x][y]) {
+        draw_mask[x][y] = brightness;
+      }
+    }
   }
+
+  return true;
 }
 // #############################################################################################
 
 
 // #############################################################################################
 // Queues a new character to be drawn in the opposite of the current character_state being used,
-// to be shown after the next transition is triggered
+// to be shown after the next transition is triggered. The CPU core only queues the character,
+// it's fetched through the glyph cache by load_new_character() on the GPU core.
 void set_new_character(char character) {
-  int32_t address = lookup_ascii_address(character);
+  push_render_command(RENDER_COMMAND_LOAD_CHARACTER, character);
+}
+// #############################################################################################
 
-  memset(line_memory[!current_character_state], 0, sizeof(line) * 128);
-  line_count[!current_character_state] = 0;
 
-  if (address == -1) {
-    // Draw nothing if character provided has ascii address out of range
-  } else {
-    load_vector_to_line_memory(!current_character_state, ascii_font, address);
+// #############################################################################################
+// GPU core: point line memory (slot) at a cached character
+void set_line_memory_character(uint8_t slot, char character) {
+  // The other slot's character may still be on screen, so it can't be evicted to make room
+  line_memory_glyph[slot] = get_cached_glyph(character, line_memory_glyph[!slot]);
+  line_memory_character[slot] = character;
+
+  // A miss can move cached glyphs around, so both slots are pointed at the cache again
+  for (uint8_t i = 0; i < 2; i++) {
+    line_memory[i] = get_glyph_mesh(line_memory_glyph[i]);
+  }
+
+#if GLYPH_RENDER_SDF == 1
+  if (line_memory_field[slot].CHARACTER != character) {
+    build_glyph_distance_field(line_memory[slot], character, line_memory_field[slot]);
   }
+#endif
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// GPU core: point the opposite of the current character_state being used at a cached character,
+// called by apply_render_state() when the CPU core has queued a set_new_character()
+void load_new_character(char character) {
+  set_line_memory_character(!current_character_state, character);
 
   CHARACTER_STATE[!current_character_state].OPACITY = 0.0;
 
@@ -158,69 +231,52 @@ void set_new_character(char character) {
 
 
 // #############################################################################################
-// If a transition is in progress, use a specific function defined in transitions.h to run
-// the show based on what transition type SuperPixie is currently configured to use in the
-// upcoming system state the transition is interpolating to.
-void run_character_transitions() {
-  if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_INSTANT) {
-    run_instant_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_FADE) {
-    run_fade_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_FADE_OUT) {
-    run_fade_out_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_SPIN_LEFT) {
-    run_spin_left_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_SPIN_RIGHT) {
-    run_spin_right_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_SPIN_LEFT_HALF) {
-    run_spin_left_half_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_SPIN_RIGHT_HALF) {
-    run_spin_right_half_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_PUSH_UP) {
-    run_push_up_transition();
+// Compositor layers: one per character slot, with the slot in layer.PARAMETER. Slot 0's layer
+// is prepared first and runs the character transitions for both. Each slot is drawn to a spare
+// mask and only swapped in, marking the layer dirty, if it came out different.
+bool prepare_character_layer(compositor_layer& layer) {
+  uint8_t slot = layer.PARAMETER;
+
+  // A running marquee (marquee.h) places both characters itself
+  if (slot == 0 && run_marquee() == false) {
+    run_character_transitions();
   }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_PUSH_DOWN) {
-    run_push_down_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_PUSH_LEFT) {
-    run_push_left_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_PUSH_RIGHT) {
-    run_push_right_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_SHRINK) {
-    run_shrink_transition();
-  }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_FLIP_HORIZONTAL) {
-    run_flip_horizontal_transition();
+
+  // Hidden under the stream layer anyway (stream.h), transitions still run so they end on time
+  if (stream_active == true) {
+    return false;
   }
-  else if (SYSTEM_STATE_INTERNAL[!current_system_state].TRANSITION_TYPE == TRANSITION_FLIP_VERTICAL) {
-    run_flip_vertical_transition();
+
+  static float new_mask[LEDS_X][LEDS_Y];
+  memset(new_mask, 0, sizeof(new_mask));
+
+  // Invisible or off the panel
+  if (draw_vector_from_line_memory(slot, new_mask, CHARACTER_STATE[slot].POSITION, CHARACTER_STATE[slot].SCALE, CHARACTER_STATE[slot].ROTATION, CHARACTER_STATE[slot].OPACITY) == false) {
+    return false;
   }
-}
-// #############################################################################################
 
+  if (memcmp(new_mask, character_mask[slot], sizeof(new_mask)) != 0) {
+    memcpy(character_mask[slot], new_mask, sizeof(new_mask));
+    layer.DIRTY = true;
+  }
 
-// #############################################################################################
-// Draw both character states and the contents of line_memory[][] to the character masks, to 
-// be summed up later in the GPU loop
-void draw_characters() {
-  run_character_transitions();
+  // The display colors are shared by both slots
+  update_display_color_map();
+  if (character_layer_color_serial[slot] != display_color_map_serial) {
+    character_layer_color_serial[slot] = display_color_map_serial;
+    layer.DIRTY = true;
+  }
 
-  memset(character_mask[0], 0, sizeof(float) * LEDS_X * LEDS_Y);
-  memset(character_mask[1], 0, sizeof(float) * LEDS_X * LEDS_Y);
+  return true;
+}
 
-  draw_vector_from_line_memory(0, character_mask[0], CHARACTER_STATE[0].POSITION, CHARACTER_STATE[0].SCALE, CHARACTER_STATE[0].ROTATION, CHARACTER_STATE[0].OPACITY);
-  draw_vector_from_line_memory(1, character_mask[1], CHARACTER_STATE[1].POSITION, CHARACTER_STATE[1].SCALE, CHARACTER_STATE[1].ROTATION, CHARACTER_STATE[1].OPACITY);
+// Converts the monochromatic character mask to an RGB image using solid colors or gradients
+void character_layer_source(const compositor_layer& layer, uint8_t x, uint8_t y, CRGBF& color, float& alpha) {
+  float mask = character_mask[layer.PARAMETER][x][y];
 
-  draw_mask_to_leds(character_mask[0]);
-  draw_mask_to_leds(character_mask[1]);
+  // Color at this pixel is (base + mask * slope), slope is only non-zero for GRADIENT_BRIGHTNESS
+  color.r = mask * (display_color_map[x][y].r + mask * display_color_map_slope[x][y].r);
+  color.g = mask * (display_color_map[x][y].g + mask * display_color_map_slope[x][y].g);
+  color.b = mask * (display_color_map[x][y].b + mask * display_color_map_slope[x][y].b);
 }
-// #############################################################################################
\ No newline at end of file
+// #############################################################################################
@@ -0,0 +1,402 @@
+// #############################################################################################
+// SuperPixie native benchmark
+//
+// Builds the node firmware (examples/SUPERPIXIE_FIRMWARE) for the machine it's run on, against
+// the stand-ins in stubs/, and times its hot paths so a performance regression shows up
+// without an ESP32 on the desk:
+//
+//   Render   ns per frame for each stage of render_frame(), measured by the firmware's own
+//            frame profiler (profiler.h), in a few typical workloads
+//   Raster   ns per draw_vector_from_line_memory() call, for glyphs at random transforms
+//   Glyphs   benchmark_glyph_rendering() (test_code.h): the segment rasterizer against the
+//            distance field renderer, over every glyph in the font. The benchmark exits
+//            non-zero if the two differ by more than GLYPH_SDF_MAX_ERROR or GLYPH_SDF_MEAN_ERROR.
+//   Parser   bytes per microsecond through receive_chain_data(), for a few packet mixes
+//
+// Time on the node is virtual and advances BENCH_FRAME_US every frame, so every run renders
+// exactly the same frames. The numbers are host time, so compare them between runs on the
+// same machine, not with the hardware.
+//
+//   make -C extras/native
+//   extras/native/bench [frames per workload]
+
+#include "Arduino.h"
+#include "../../examples/SUPERPIXIE_FIRMWARE/SUPERPIXIE_FIRMWARE.ino"
+
+#include <cstdio>
+
+#define BENCH_FRAME_US 10000          // 100 FPS
+#define BENCH_DEFAULT_FRAMES 2000
+#define BENCH_WARMUP_FRAMES 200       // Long enough for the boot fade in and ripple to finish
+#define BENCH_RASTER_CALLS 200000
+#define BENCH_PARSER_BYTES (4 * 1024 * 1024)
+
+const char* profile_stage_names[NUM_PROFILE_STAGES] = {
+  "frame", "render_state", "transition", "backlight", "background", "characters", "stream",
+  "debug", "effects", "touch", "composite", "brightness", "output",
+};
+
+struct bench_workload {
+  const char* NAME;
+  void (*START)();
+  void (*RUN_FRAME)(uint32_t frame);  // Host side work before each frame, may be NULL
+  void (*STOP)();                     // May be NULL
+};
+
+// #############################################################################################
+// Nanoseconds since the benchmark started
+uint64_t get_host_ns() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Boot the node the way init_cores() would, as the only node of a chain that's already been
+// discovered and sent a show()
+void boot_node() {
+  init_system();
+  system_ready = true;
+  init_gpu();
+
+  CHAIN_CONFIG.LOCAL_ADDRESS = 0;
+  CHAIN_CONFIG.CHAIN_LENGTH = 1;
+  assignment_complete = true;
+  discovery_complete = true;
+  show_called_once = true;  // No '?' from check_data()
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Run one frame of both cores: a pass of the CPU core's loop, then the frame itself
+void run_frame() {
+  run_cpu_tasks();
+
+  native_advance_us(BENCH_FRAME_US);
+  render_frame();
+
+  Serial.transmitted.clear();
+  Serial2.transmitted.clear();
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Workloads
+
+void show_character(char character, uint8_t transition_type, uint16_t duration_ms) {
+  set_transition_type(transition_type);
+  set_transition_time_ms(duration_ms);
+  set_new_character(character);
+  trigger_transition();
+}
+
+// A character that never changes, so most frames skip compositing entirely
+void start_static() {
+  show_character('8', TRANSITION_INSTANT, 0);
+}
+
+// A new digit every quarter second, cycling through the built in transitions
+void run_transitions_frame(uint32_t frame) {
+  if (frame % 25 == 0) {
+    uint8_t transition_type = TRANSITION_FADE + (frame / 25) % (TRANSITION_PUSH_RIGHT - TRANSITION_FADE + 1);
+    show_character('0' + (frame / 25) % 10, transition_type, 200);
+  }
+}
+
+// A looping marquee, both character slots move every frame
+void set_marquee(const char* string) {
+  uint8_t data[6 + MARQUEE_MAX_LENGTH] = {
+    MARQUEE_FLAG_LOOP,
+    0x05, 0xDC,  // 15.00 LEDs per second
+    0, 0,        // No delay
+    120,         // 12.0 LEDs from one character to the next
+  };
+  uint8_t length = strlen(string);
+  memcpy(&data[6], string, length);
+
+  set_marquee_packet(data, 6 + length, CHAIN_CONFIG.LOCAL_ADDRESS, CHAIN_CONFIG.CHAIN_LENGTH, false);
+}
+
+void start_marquee() {
+  set_marquee("SUPERPIXIE 0123456789");
+}
+
+void stop_marquee() {
+  set_marquee("");
+}
+
+// A full RGB frame from the host every frame, in as many fragments as the library would send
+void run_stream_frame(uint32_t frame) {
+  const uint8_t pixels_per_fragment = STREAM_MAX_FRAGMENT_DATA / 3;
+
+  for (uint8_t first_pixel = 0; first_pixel < STREAM_PIXELS; first_pixel += pixels_per_fragment) {
+    uint8_t count = min(pixels_per_fragment, uint8_t(STREAM_PIXELS - first_pixel));
+
+    uint8_t data[STREAM_FRAGMENT_HEADER + STREAM_MAX_FRAGMENT_DATA] = { uint8_t(frame), STREAM_RGB, first_pixel };
+    for (uint8_t i = 0; i < count; i++) {
+      uint8_t pixel = first_pixel + i;
+      data[STREAM_FRAGMENT_HEADER + i * 3 + 0] = pixel * 2 + frame;
+      data[STREAM_FRAGMENT_HEADER + i * 3 + 1] = frame;
+      data[STREAM_FRAGMENT_HEADER + i * 3 + 2] = 255 - pixel * 2;
+    }
+
+    receive_stream_fragment(data, STREAM_FRAGMENT_HEADER + count * 3);
+  }
+}
+
+void stop_stream() {
+  uint8_t data[STREAM_FRAGMENT_HEADER] = { 0, STREAM_STOP, 0 };
+  receive_stream_fragment(data, STREAM_FRAGMENT_HEADER);
+}
+
+const bench_workload bench_workloads[] = {
+  { "static", start_static, NULL, NULL },
+  { "transitions", NULL, run_transitions_frame, NULL },
+  { "marquee", start_marquee, NULL, stop_marquee },
+  { "stream", NULL, run_stream_frame, stop_stream },
+};
+
+#define NUM_BENCH_WORKLOADS (sizeof(bench_workloads) / sizeof(bench_workload))
+// #############################################################################################
+
+
+// #############################################################################################
+// Render (frames) frames of (workload), leaving the average ns per frame of each stage in
+// (stage_ns_out)
+void bench_workload_frames(const bench_workload& workload, uint32_t frames, double* stage_ns_out) {
+  if (workload.START != NULL) {
+    workload.START();
+  }
+
+  for (uint32_t frame = 0; frame < BENCH_WARMUP_FRAMES + frames; frame++) {
+    if (frame == BENCH_WARMUP_FRAMES) {
+      profile_reset_requested = true;  // Cleared at the end of the next frame
+      run_frame();
+    }
+
+    if (workload.RUN_FRAME != NULL) {
+      workload.RUN_FRAME(frame);
+    }
+    run_frame();
+  }
+
+  for (uint8_t stage = 0; stage < NUM_PROFILE_STAGES; stage++) {
+    const profile_histogram& histogram = profile_histograms[stage];
+    stage_ns_out[stage] = histogram.TOTAL_CYCLES * (1000000000.0 / F_CPU) / histogram.SAMPLES;
+  }
+
+  if (workload.STOP != NULL) {
+    workload.STOP();
+  }
+
+  // Let it settle back to a blank display for the next workload
+  show_character(' ', TRANSITION_INSTANT, 0);
+  for (uint32_t frame = 0; frame < BENCH_WARMUP_FRAMES; frame++) {
+    run_frame();
+  }
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Average ns per draw_vector_from_line_memory() call, cycling through the printable characters
+// at a spread of positions, scales and rotations
+double bench_raster() {
+  static float mask[LEDS_X][LEDS_Y];
+  uint32_t calls = 0;
+  uint64_t total_ns = 0;
+
+  for (char character = '!'; character <= '~'; character++) {
+    set_line_memory_character(0, character);
+
+    uint64_t start_ns = get_host_ns();
+    for (uint32_t i = 0; i < BENCH_RASTER_CALLS / ('~' - '!' + 1); i++) {
+      float t = i * 0.01f;
+      vec2D position = { sinf(t) * 2.0f, cosf(t * 0.7f) * 3.0f };
+      vec2D scale = { 1.0f + 0.25f * sinf(t * 1.3f), 1.0f + 0.25f * cosf(t * 1.1f) };
+
+      memset(mask, 0, sizeof(mask));
+      draw_vector_from_line_memory(0, mask, position, scale, t * 40.0f, 1.0f);
+      calls++;
+    }
+    total_ns += get_host_ns() - start_ns;
+  }
+
+  return double(total_ns) / calls;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Packets for the parser benchmark, encoded by the firmware's own send_packet()
+
+void add_packet(std::vector<uint8_t>& stream, uint8_t command_type, uint8_t destination_address, uint8_t data_length, uint8_t* data) {
+  // The only node of the chain keeps chain_right for telemetry, so encode as one further up
+  bool terminating = terminating_node;
+  terminating_node = false;
+
+  chain_right.transmitted.clear();
+  send_packet(DOWNSTREAM, command_type, destination_address, data_length, data);
+  stream.insert(stream.end(), chain_right.transmitted.begin(), chain_right.transmitted.end());
+  chain_right.transmitted.clear();
+
+  terminating_node = terminating;
+}
+
+// The largest packets the library sends, for a node further down the chain: framing only
+void build_passing_packets(std::vector<uint8_t>& stream) {
+  uint8_t data[54];
+  for (uint8_t i = 0; i < sizeof(data); i++) {
+    data[i] = 'A' + i % 26;
+  }
+  add_packet(stream, COM_SET_STRING, 5, sizeof(data), data);
+}
+
+// Whole RGB stream frames for this node
+void build_stream_packets(std::vector<uint8_t>& stream) {
+  static uint8_t sequence = 0;
+  const uint8_t pixels_per_fragment = STREAM_MAX_FRAGMENT_DATA / 3;
+
+  for (uint8_t first_pixel = 0; first_pixel < STREAM_PIXELS; first_pixel += pixels_per_fragment) {
+    uint8_t count = min(pixels_per_fragment, uint8_t(STREAM_PIXELS - first_pixel));
+
+    uint8_t data[STREAM_FRAGMENT_HEADER + STREAM_MAX_FRAGMENT_DATA] = { sequence, STREAM_RGB, first_pixel };
+    for (uint8_t i = 0; i < count * 3; i++) {
+      data[STREAM_FRAGMENT_HEADER + i] = first_pixel + i;
+    }
+    add_packet(stream, COM_STREAM_FRAME, CHAIN_CONFIG.LOCAL_ADDRESS, STREAM_FRAGMENT_HEADER + count * 3, data);
+  }
+  sequence++;
+}
+
+// The short commands a show() is usually made of, broadcast
+void build_command_packets(std::vector<uint8_t>& stream) {
+  static uint8_t counter = 0;
+  uint8_t data[1];
+
+  data[0] = counter;
+  add_packet(stream, COM_SET_BRIGHTNESS, ADDRESS_BROADCAST, 1, data);
+  data[0] = 64;
+  add_packet(stream, COM_SET_FRAME_BLENDING, ADDRESS_BROADCAST, 1, data);
+  data[0] = '0' + counter % 10;
+  add_packet(stream, COM_SET_CHARACTER, ADDRESS_BROADCAST, 1, data);
+  add_packet(stream, COM_SHOW, ADDRESS_BROADCAST, 0, NULL_DATA);
+
+  counter++;
+}
+
+struct bench_packet_mix {
+  const char* NAME;
+  void (*BUILD)(std::vector<uint8_t>& stream);  // Appends a few packets
+};
+
+const bench_packet_mix bench_packet_mixes[] = {
+  { "passing through", build_passing_packets },
+  { "stream frames", build_stream_packets },
+  { "show() commands", build_command_packets },
+};
+
+#define NUM_BENCH_PACKET_MIXES (sizeof(bench_packet_mixes) / sizeof(bench_packet_mix))
+// #############################################################################################
+
+
+// #############################################################################################
+// Bytes per microsecond through receive_chain_data() for (mix), fed in from the left
+double bench_parser(const bench_packet_mix& mix) {
+  std::vector<uint8_t> stream;
+  while (stream.size() < 64 * 1024) {
+    mix.BUILD(stream);
+  }
+
+  uint64_t total_bytes = 0;
+  uint64_t total_ns = 0;
+
+  while (total_bytes < BENCH_PARSER_BYTES) {
+    chain_left.native_receive(stream.data(), stream.size());
+
+    uint64_t start_ns = get_host_ns();
+    receive_chain_data();
+    total_ns += get_host_ns() - start_ns;
+    total_bytes += stream.size();
+
+    // Keep the GPU core's side of the render state moving, so the command ring never fills
+    run_frame();
+  }
+
+  return total_bytes * 1000.0 / total_ns;
+}
+// #############################################################################################
+
+
+int main(int argc, char** argv) {
+  uint32_t frames = BENCH_DEFAULT_FRAMES;
+  if (argc > 1) {
+    frames = strtoul(argv[1], NULL, 10);
+  }
+
+  boot_node();
+  for (uint32_t frame = 0; frame < BENCH_WARMUP_FRAMES; frame++) {
+    run_frame();
+  }
+
+  printf("SuperPixie native benchmark, %u frames per workload at %u FPS\n\n", frames, 1000000 / BENCH_FRAME_US);
+
+  // Render --------------------------------------------------------------------------------
+  double stage_ns[NUM_BENCH_WORKLOADS][NUM_PROFILE_STAGES];
+  for (uint8_t w = 0; w < NUM_BENCH_WORKLOADS; w++) {
+    bench_workload_frames(bench_workloads[w], frames, stage_ns[w]);
+  }
+
+  printf("%-22s", "Render (ns/frame)");
+  for (uint8_t w = 0; w < NUM_BENCH_WORKLOADS; w++) {
+    printf("%13s", bench_workloads[w].NAME);
+  }
+  printf("\n");
+
+  double total_ns[NUM_BENCH_WORKLOADS] = {};
+  for (uint8_t stage = PROFILE_FRAME + 1; stage < NUM_PROFILE_STAGES; stage++) {
+    printf("  %-20s", profile_stage_names[stage]);
+    for (uint8_t w = 0; w < NUM_BENCH_WORKLOADS; w++) {
+      printf("%13.0f", stage_ns[w][stage]);
+      total_ns[w] += stage_ns[w][stage];
+    }
+    printf("\n");
+  }
+
+  printf("  %-20s", "total");
+  for (uint8_t w = 0; w < NUM_BENCH_WORKLOADS; w++) {
+    printf("%13.0f", total_ns[w]);
+  }
+  printf("\n\n");
+
+  // Raster --------------------------------------------------------------------------------
+  printf("Raster (ns/call)\n");
+  printf("  %-20s%13.0f\n\n", "draw_vector", bench_raster());
+
+  // Glyphs --------------------------------------------------------------------------------
+  glyph_benchmark_results glyphs = benchmark_glyph_rendering();
+
+  printf("Glyphs (ns)\n");
+  printf("  %-20s%13.0f\n", "field build", glyphs.BUILD_US * 1000.0);
+  printf("  %-20s%13.0f\n", "segments draw", glyphs.SEGMENTS_US * 1000.0);
+  printf("  %-20s%13.0f\n", "sdf draw", glyphs.SDF_US * 1000.0);
+  printf("  %-20s%13u\n", "sdf fallbacks", glyphs.FALLBACKS);
+  printf("  %-20s%13.4f  (limit %.4f)\n", "max error", glyphs.MAX_ERROR, GLYPH_SDF_MAX_ERROR);
+  printf("  %-20s%13.4f  (limit %.4f)\n\n", "mean error", glyphs.MEAN_ERROR, GLYPH_SDF_MEAN_ERROR);
+
+  // Parser --------------------------------------------------------------------------------
+  printf("Parser (bytes/us)\n");
+  for (uint8_t m = 0; m < NUM_BENCH_PACKET_MIXES; m++) {
+    printf("  %-20s%13.1f\n", bench_packet_mixes[m].NAME, bench_parser(bench_packet_mixes[m]));
+  }
+
+  if (glyphs.PASSED == false) {
+    printf("\nFAIL: the distance field renderer strays too far from the segment rasterizer\n");
+    return 1;
+  }
+
+  return 0;
+}
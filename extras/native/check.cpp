@@ -0,0 +1,203 @@
+// #############################################################################################
+// SuperPixie native checks
+//
+// Builds the node firmware (examples/SUPERPIXIE_FIRMWARE) for the machine it's run on, against
+// the same stand-ins as bench.cpp, and compares the parts of it that were rewritten for speed
+// against slower versions that are obviously correct. Every check prints what it compared, and
+// the program exits non-zero if any of them failed.
+//
+//   make -C extras/native check
+
+#include "Arduino.h"
+#include "../../examples/SUPERPIXIE_FIRMWARE/SUPERPIXIE_FIRMWARE.ino"
+
+#include <cstdio>
+
+#include "transition_golden.h"
+
+#define CHECK_PARALLEL_FRAMES 1000
+#define CHECK_TRANSITION_MAX_ERROR 0.0001  // Keyframe interpolation against the old closed forms
+
+struct native_check {
+  const char* NAME;
+  bool (*RUN)();
+};
+
+// #############################################################################################
+// encode_parallel_frame() against encode_parallel_frame_reference() (parallel_output.h), for
+// random leds_8 frames on every lane
+bool check_parallel_encoder() {
+  static uint8_t encoded[LED_PARALLEL_FRAME_BYTES(NUM_LEDS_PER_STRIP)];
+  static uint8_t reference[LED_PARALLEL_FRAME_BYTES(NUM_LEDS_PER_STRIP)];
+
+  srand(1);
+
+  uint32_t mismatched_frames = 0;
+  uint32_t mismatched_bytes = 0;
+
+  for (uint32_t frame = 0; frame < CHECK_PARALLEL_FRAMES; frame++) {
+    for (uint8_t x = 0; x < LEDS_X; x++) {
+      for (uint8_t y = 0; y < NUM_LEDS_PER_STRIP; y++) {
+        leds_8[x][y] = CRGB(rand() & 0xFF, rand() & 0xFF, rand() & 0xFF);
+      }
+    }
+
+    memset(encoded, 0xAA, sizeof(encoded));
+    memset(reference, 0x55, sizeof(reference));
+
+    encode_parallel_frame(leds_8[0], LEDS_X, NUM_LEDS_PER_STRIP, encoded);
+    encode_parallel_frame_reference(leds_8[0], LEDS_X, NUM_LEDS_PER_STRIP, reference);
+
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < sizeof(encoded); i++) {
+      if (encoded[i] != reference[i]) {
+        if (mismatches == 0 && mismatched_frames == 0) {
+          printf("    frame %u, first mismatch at byte %u: 0x%02X, reference 0x%02X\n", frame, i, encoded[i], reference[i]);
+        }
+        mismatches++;
+      }
+    }
+
+    if (mismatches > 0) {
+      mismatched_frames++;
+      mismatched_bytes += mismatches;
+    }
+  }
+
+  printf("    %u random frames, %u mismatched (%u bytes)\n", CHECK_PARALLEL_FRAMES, mismatched_frames, mismatched_bytes);
+  return mismatched_frames == 0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Value of (property) in (state), in the order of transition_properties
+float get_transition_property(const character_state& state, uint8_t property) {
+  const float values[NUM_TRANSITION_PROPERTIES] = { state.OPACITY, state.POSITION.x, state.POSITION.y, state.SCALE.x, state.SCALE.y, state.ROTATION };
+  return values[property];
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Largest difference from (sample) when (transition_type) is run to the same progress from
+// CHARACTER_STATE_DEFAULTS
+float get_transition_error(uint8_t transition_type, const transition_golden_sample& sample) {
+  current_character_state = 0;
+  memcpy(&CHARACTER_STATE[0], &CHARACTER_STATE_DEFAULTS, sizeof(character_state));
+  memcpy(&CHARACTER_STATE[1], &CHARACTER_STATE_DEFAULTS, sizeof(character_state));
+
+  active_transition_type = transition_type;
+  system_state_transition_progress = sample.SIXTEENTHS / 16.0;
+  system_state_transition_progress_shaped = sample.SIXTEENTHS / 16.0;
+
+  run_character_transitions();
+
+  float error = 0.0;
+  for (uint8_t property = 0; property < NUM_TRANSITION_PROPERTIES; property++) {
+    error = max(error, fabsf(get_transition_property(CHARACTER_STATE[1], property) - sample.INCOMING[property]));
+    error = max(error, fabsf(get_transition_property(CHARACTER_STATE[0], property) - sample.OUTGOING[property]));
+  }
+
+  return error;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Every built in transition table (transitions.h) against transition_golden.h
+bool check_transition_tables() {
+  const uint32_t num_samples = sizeof(transition_golden) / sizeof(transition_golden_sample);
+  uint32_t failures = 0;
+  float worst_error = 0.0;
+
+  for (uint32_t i = 0; i < num_samples; i++) {
+    const transition_golden_sample& sample = transition_golden[i];
+
+    float error = get_transition_error(sample.TYPE, sample);
+    if (error > CHECK_TRANSITION_MAX_ERROR) {
+      printf("    transition %u at %u/16: off by %g\n", sample.TYPE, sample.SIXTEENTHS, error);
+      failures++;
+    }
+    worst_error = max(worst_error, error);
+  }
+
+  printf("    %u samples, %u out of bounds, worst difference %g\n", num_samples, failures, worst_error);
+  return failures == 0;
+}
+// #############################################################################################
+
+
+// #############################################################################################
+// Upload TRANSITION_PUSH_UP's tracks as TRANSITION_CUSTOM_A with COM_SET_TRANSITION_TRACK's
+// encoding, and check the GPU core only sees them once they're published, then runs them just
+// like the built in table
+bool check_custom_transition_upload() {
+  const transition_table& table = transition_tables[TRANSITION_PUSH_UP];
+
+  for (uint8_t t = 0; t < table.NUM_TRACKS; t++) {
+    const transition_track& track = table.TRACKS[t];
+
+    uint8_t data[TRANSITION_MAX_KEYFRAMES * 3];
+    for (uint8_t k = 0; k < track.NUM_KEYFRAMES; k++) {
+      int16_t value = lroundf(track.KEYFRAMES[k].VALUE * transition_property_steps[track.PROPERTY]);
+      data[k * 3 + 0] = track.KEYFRAMES[k].TIME;
+      data[k * 3 + 1] = uint16_t(value) >> 8;
+      data[k * 3 + 2] = uint16_t(value) & 0xFF;
+    }
+
+    set_custom_transition_track(TRANSITION_CUSTOM_A, t, track.SLOT, track.PROPERTY, track.NUM_KEYFRAMES, data);
+  }
+
+  // Still the crossfade from init_custom_transitions() until the upload is published
+  bool held_back = (custom_transitions[0].NUM_TRACKS == 2 && custom_transitions[0].TRACKS[0].PROPERTY == TRANSITION_OPACITY && custom_transitions[0].TRACKS[1].PROPERTY == TRANSITION_OPACITY);
+  printf("    %s until published\n", held_back ? "held back" : "visible to the GPU core");
+
+  publish_render_state();
+  apply_render_state();
+
+  const uint32_t num_samples = sizeof(transition_golden) / sizeof(transition_golden_sample);
+  float worst_error = 0.0;
+  for (uint32_t i = 0; i < num_samples; i++) {
+    if (transition_golden[i].TYPE == TRANSITION_PUSH_UP) {
+      worst_error = max(worst_error, get_transition_error(TRANSITION_CUSTOM_A, transition_golden[i]));
+    }
+  }
+
+  printf("    worst difference from TRANSITION_PUSH_UP %g\n", worst_error);
+  return held_back == true && worst_error <= CHECK_TRANSITION_MAX_ERROR;
+}
+// #############################################################################################
+
+
+const native_check native_checks[] = {
+  { "parallel encoder", check_parallel_encoder },
+  { "transition tables", check_transition_tables },
+  { "custom transition upload", check_custom_transition_upload },
+};
+
+#define NUM_NATIVE_CHECKS (sizeof(native_checks) / sizeof(native_check))
+
+
+int main() {
+  uint8_t failures = 0;
+
+  // Bring the node up the way loop_cpu() and loop_gpu() would
+  init_system();
+  system_ready = true;
+  init_gpu();
+
+  for (uint8_t c = 0; c < NUM_NATIVE_CHECKS; c++) {
+    printf("%s\n", native_checks[c].NAME);
+
+    bool passed = native_checks[c].RUN();
+    printf("  %s\n", passed ? "PASS" : "FAIL");
+
+    if (passed == false) {
+      failures++;
+    }
+  }
+
+  printf("\n%u of %u checks failed\n", failures, unsigned(NUM_NATIVE_CHECKS));
+  return (failures > 0) ? 1 : 0;
+}
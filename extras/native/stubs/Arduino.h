@@ -0,0 +1,146 @@
+// #############################################################################################
+// Native stand-in for the parts of the ESP32 Arduino core the node firmware uses
+//
+// Just enough to compile and run the firmware on a desktop machine. Time is virtual, so a
+// benchmark renders the same frames however fast the machine is: millis() and micros() only
+// move when native_advance_us() or delay() moves them. ESP.getCycleCount() does follow the
+// real clock, scaled to F_CPU, so the frame profiler (profiler.h) measures real host time.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "binary.h"
+
+typedef uint8_t byte;
+
+using std::max;
+using std::min;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+#define F_CPU 240000000
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+
+// ---------------------------------------------------------------------------------------------
+// Time
+
+inline uint64_t native_time_us = 0;
+
+inline void native_advance_us(uint32_t us) { native_time_us += us; }
+
+inline uint32_t millis() { return native_time_us / 1000; }
+inline uint32_t micros() { return native_time_us; }
+inline void delay(uint32_t ms) { native_advance_us(ms * 1000); }
+inline void delayMicroseconds(uint32_t us) { native_advance_us(us); }
+inline void yield() {}
+
+// ---------------------------------------------------------------------------------------------
+// GPIO, the RX lines idle HIGH so check_reset() never sees a reset pulse, and the touch pad is
+// never touched
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline uint16_t touchRead(uint8_t) { return 70; }
+
+inline long random(long low, long high) { return low + (rand() % (high - low)); }
+inline long random(long high) { return rand() % high; }
+
+#define SIG_IN_FUNC224_IDX 224
+inline void gpio_matrix_in(int, int, bool) {}
+inline void gpio_matrix_out(int, int, bool, bool) {}
+
+#define REG_WRITE(address, value) ((void)(address), (void)(value))
+#define RTC_CNTL_OPTIONS0_REG 0
+#define RTC_CNTL_SW_SYS_RST 0
+
+// ---------------------------------------------------------------------------------------------
+// UARTs: bytes passed to native_receive() are handed to read(), and everything written is kept
+// in (transmitted) until the harness clears it. print() is dropped.
+
+#define SERIAL_8N1 0
+
+struct HardwareSerial {
+  std::vector<uint8_t> received;
+  size_t read_index = 0;
+  std::vector<uint8_t> transmitted;
+
+  void native_receive(const uint8_t* data, size_t length) {
+    received.insert(received.end(), data, data + length);
+  }
+
+  void begin(uint32_t, int = 0, int = -1, int = -1) {}
+  void updateBaudRate(uint32_t) {}
+  void flush() {}
+
+  int available() { return received.size() - read_index; }
+  int read() {
+    if (read_index >= received.size()) {
+      return -1;
+    }
+
+    uint8_t value = received[read_index++];
+    if (read_index == received.size()) {
+      received.clear();
+      read_index = 0;
+    }
+    return value;
+  }
+
+  int availableForWrite() { return 128; }
+  size_t write(uint8_t value) {
+    transmitted.push_back(value);
+    return 1;
+  }
+  size_t write(const uint8_t* data, size_t length) {
+    transmitted.insert(transmitted.end(), data, data + length);
+    return length;
+  }
+
+  template <typename T> void print(T) {}
+  template <typename T> void print(T, int) {}
+  template <typename T> void println(T) {}
+  template <typename T> void println(T, int) {}
+  void println() {}
+};
+
+inline HardwareSerial Serial;
+inline HardwareSerial Serial2;
+
+// ---------------------------------------------------------------------------------------------
+// ESP
+
+struct EspClass {
+  uint32_t getCycleCount() {
+    static const auto start = std::chrono::steady_clock::now();
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return ns * (F_CPU / 1000000) / 1000;
+  }
+  void restart() {}
+};
+
+inline EspClass ESP;
@@ -0,0 +1,18 @@
+// Native stand-in for the Arduino FS File, always closed
+
+#pragma once
+
+#include "Arduino.h"
+
+struct File {
+  operator bool() const { return false; }
+
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t read(uint8_t*, size_t) { return 0; }
+  size_t write(uint8_t) { return 0; }
+  size_t write(const uint8_t*, size_t) { return 0; }
+  bool seek(uint32_t) { return false; }
+  size_t size() { return 0; }
+  void close() {}
+};
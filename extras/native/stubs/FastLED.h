@@ -0,0 +1,43 @@
+// Native stand-in for FastLED: the color types and an LED controller that sends nowhere
+
+#pragma once
+
+#include "Arduino.h"
+
+struct CRGB {
+  uint8_t r, g, b;
+
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t r_, uint8_t g_, uint8_t b_) : r(r_), g(g_), b(b_) {}
+};
+
+// Only used by test_code.h, gray is close enough
+struct CHSV {
+  uint8_t h, s, v;
+
+  CHSV(uint8_t h_, uint8_t s_, uint8_t v_) : h(h_), s(s_), v(v_) {}
+  operator CRGB() const { return CRGB(v, v, v); }
+};
+
+struct CLEDController {
+  CLEDController& setLeds(CRGB*, int) { return *this; }
+  void showLeds(uint8_t = 255) {}
+};
+
+enum EOrder { RGB, GRB };
+template <uint8_t DATA_PIN> struct WS2812B {};
+
+#define DISABLE_DITHER 0
+
+struct CFastLED {
+  template <template <uint8_t> class CHIPSET, uint8_t DATA_PIN, EOrder ORDER>
+  CLEDController& addLeds(CRGB*, int) {
+    static CLEDController controller;  // One per pin, like the real thing
+    return controller;
+  }
+
+  void setBrightness(uint8_t) {}
+  void setDither(uint8_t) {}
+};
+
+inline CFastLED FastLED;
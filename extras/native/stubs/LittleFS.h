@@ -0,0 +1,16 @@
+// Native stand-in for LittleFS: an empty file system that can't be written, so the firmware
+// boots with its defaults every time
+
+#pragma once
+
+#include "FS.h"
+
+struct LittleFSFS {
+  bool begin(bool = false) { return true; }
+  bool format() { return true; }
+  bool exists(const char*) { return false; }
+  bool remove(const char*) { return false; }
+  File open(const char*, const char*) { return File(); }
+};
+
+inline LittleFSFS LittleFS;
@@ -0,0 +1,52 @@
+// Native stand-in for the ESP-IDF I2S LCD driver, used when LED_OUTPUT_PARALLEL is 1. Frames
+// are encoded as usual and then dropped, finishing as soon as they're queued.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct esp_lcd_i80_bus_t* esp_lcd_i80_bus_handle_t;
+typedef struct esp_lcd_panel_io_t* esp_lcd_panel_io_handle_t;
+typedef struct {} esp_lcd_panel_io_event_data_t;
+typedef bool (*esp_lcd_panel_io_color_trans_done_cb_t)(esp_lcd_panel_io_handle_t, esp_lcd_panel_io_event_data_t*, void*);
+
+enum { LCD_CLK_SRC_DEFAULT };
+
+typedef struct {
+  int dc_gpio_num;
+  int wr_gpio_num;
+  int clk_src;
+  int data_gpio_nums[16];
+  size_t bus_width;
+  size_t max_transfer_bytes;
+} esp_lcd_i80_bus_config_t;
+
+typedef struct {
+  int cs_gpio_num;
+  uint32_t pclk_hz;
+  size_t trans_queue_depth;
+  esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+  void* user_ctx;
+  int lcd_cmd_bits;
+  int lcd_param_bits;
+  struct {
+    unsigned dc_idle_level, dc_cmd_level, dc_dummy_level, dc_data_level;
+  } dc_levels;
+} esp_lcd_panel_io_i80_config_t;
+
+inline esp_lcd_panel_io_i80_config_t native_panel_io_config = {};
+
+inline int esp_lcd_new_i80_bus(const esp_lcd_i80_bus_config_t*, esp_lcd_i80_bus_handle_t*) { return 0; }
+
+inline int esp_lcd_new_panel_io_i80(esp_lcd_i80_bus_handle_t, const esp_lcd_panel_io_i80_config_t* config, esp_lcd_panel_io_handle_t*) {
+  native_panel_io_config = *config;
+  return 0;
+}
+
+inline int esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int, const void*, size_t) {
+  if (native_panel_io_config.on_color_trans_done != nullptr) {
+    native_panel_io_config.on_color_trans_done(io, nullptr, native_panel_io_config.user_ctx);
+  }
+  return 0;
+}
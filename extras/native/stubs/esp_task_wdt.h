@@ -0,0 +1,5 @@
+#pragma once
+
+inline void esp_task_wdt_add(void*) {}
+inline void esp_task_wdt_reset() {}
+inline void esp_task_wdt_delete(void*) {}
@@ -0,0 +1,16 @@
+// Native stand-in for FreeRTOS. Nothing runs in the background: tasks are never started, and
+// the harness calls the loop functions itself.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) (ms)
+#define portMAX_DELAY 0xFFFFFFFF
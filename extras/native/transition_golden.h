@@ -0,0 +1,270 @@
+// #############################################################################################
+// Golden character states for the built in transitions (see check_transition_tables() in
+// check.cpp)
+//
+// Captured from the hand written run_*_transition() functions that the keyframe tables in
+// transitions.h replaced, with both character states starting from CHARACTER_STATE_DEFAULTS.
+// Every transition is sampled at each sixteenth of its progress, including the cut halfway
+// through. Values are in the order of transition_properties in constants.h.
+
+struct transition_golden_sample {
+  uint8_t TYPE;
+  uint8_t SIXTEENTHS;  // Progress through the transition, 0-16
+  float INCOMING[NUM_TRANSITION_PROPERTIES];
+  float OUTGOING[NUM_TRANSITION_PROPERTIES];
+};
+
+const transition_golden_sample transition_golden[] = {
+  // TRANSITION_INSTANT
+  { TRANSITION_INSTANT,  0, { 0, 0, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  1, { 0.0625, 0, 0, 1, 1, 0 }, { 0.9375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  2, { 0.125, 0, 0, 1, 1, 0 }, { 0.875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  3, { 0.1875, 0, 0, 1, 1, 0 }, { 0.8125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  4, { 0.25, 0, 0, 1, 1, 0 }, { 0.75, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  5, { 0.3125, 0, 0, 1, 1, 0 }, { 0.6875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  6, { 0.375, 0, 0, 1, 1, 0 }, { 0.625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  7, { 0.4375, 0, 0, 1, 1, 0 }, { 0.5625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  8, { 0.5, 0, 0, 1, 1, 0 }, { 0.5, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT,  9, { 0.5625, 0, 0, 1, 1, 0 }, { 0.4375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 10, { 0.625, 0, 0, 1, 1, 0 }, { 0.375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 11, { 0.6875, 0, 0, 1, 1, 0 }, { 0.3125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 12, { 0.75, 0, 0, 1, 1, 0 }, { 0.25, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 13, { 0.8125, 0, 0, 1, 1, 0 }, { 0.1875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 14, { 0.875, 0, 0, 1, 1, 0 }, { 0.125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 15, { 0.9375, 0, 0, 1, 1, 0 }, { 0.0625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_INSTANT, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  // TRANSITION_FADE
+  { TRANSITION_FADE,  0, { 0, 0, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  1, { 0.0625, 0, 0, 1, 1, 0 }, { 0.9375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  2, { 0.125, 0, 0, 1, 1, 0 }, { 0.875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  3, { 0.1875, 0, 0, 1, 1, 0 }, { 0.8125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  4, { 0.25, 0, 0, 1, 1, 0 }, { 0.75, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  5, { 0.3125, 0, 0, 1, 1, 0 }, { 0.6875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  6, { 0.375, 0, 0, 1, 1, 0 }, { 0.625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  7, { 0.4375, 0, 0, 1, 1, 0 }, { 0.5625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  8, { 0.5, 0, 0, 1, 1, 0 }, { 0.5, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE,  9, { 0.5625, 0, 0, 1, 1, 0 }, { 0.4375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 10, { 0.625, 0, 0, 1, 1, 0 }, { 0.375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 11, { 0.6875, 0, 0, 1, 1, 0 }, { 0.3125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 12, { 0.75, 0, 0, 1, 1, 0 }, { 0.25, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 13, { 0.8125, 0, 0, 1, 1, 0 }, { 0.1875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 14, { 0.875, 0, 0, 1, 1, 0 }, { 0.125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 15, { 0.9375, 0, 0, 1, 1, 0 }, { 0.0625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  // TRANSITION_FADE_OUT
+  { TRANSITION_FADE_OUT,  0, { 0, 0, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  1, { 0, 0, 0, 1, 1, 0 }, { 0.875, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  2, { 0, 0, 0, 1, 1, 0 }, { 0.75, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  3, { 0, 0, 0, 1, 1, 0 }, { 0.625, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  4, { 0, 0, 0, 1, 1, 0 }, { 0.5, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  5, { 0, 0, 0, 1, 1, 0 }, { 0.375, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  6, { 0, 0, 0, 1, 1, 0 }, { 0.25, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  7, { 0, 0, 0, 1, 1, 0 }, { 0.125, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  8, { 0, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT,  9, { 0.125, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 10, { 0.25, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 11, { 0.375, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 12, { 0.5, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 13, { 0.625, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 14, { 0.75, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 15, { 0.875, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FADE_OUT, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  // TRANSITION_FLIP_HORIZONTAL
+  { TRANSITION_FLIP_HORIZONTAL,  0, { 0, 0, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  1, { 0, 0, 0, 0.875, 1, 0 }, { 1, 0, 0, 0.875, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  2, { 0, 0, 0, 0.75, 1, 0 }, { 1, 0, 0, 0.75, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  3, { 0, 0, 0, 0.625, 1, 0 }, { 1, 0, 0, 0.625, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  4, { 0, 0, 0, 0.5, 1, 0 }, { 1, 0, 0, 0.5, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  5, { 0, 0, 0, 0.375, 1, 0 }, { 1, 0, 0, 0.375, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  6, { 0, 0, 0, 0.25, 1, 0 }, { 1, 0, 0, 0.25, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  7, { 0, 0, 0, 0.125, 1, 0 }, { 1, 0, 0, 0.125, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  8, { 1, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL,  9, { 1, 0, 0, 0.125, 1, 0 }, { 0, 0, 0, 0.125, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 10, { 1, 0, 0, 0.25, 1, 0 }, { 0, 0, 0, 0.25, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 11, { 1, 0, 0, 0.375, 1, 0 }, { 0, 0, 0, 0.375, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 12, { 1, 0, 0, 0.5, 1, 0 }, { 0, 0, 0, 0.5, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 13, { 1, 0, 0, 0.625, 1, 0 }, { 0, 0, 0, 0.625, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 14, { 1, 0, 0, 0.75, 1, 0 }, { 0, 0, 0, 0.75, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 15, { 1, 0, 0, 0.875, 1, 0 }, { 0, 0, 0, 0.875, 1, 0 } },
+  { TRANSITION_FLIP_HORIZONTAL, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  // TRANSITION_FLIP_VERTICAL
+  { TRANSITION_FLIP_VERTICAL,  0, { 0, 0, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  1, { 0, 0, 0, 1, 0.875, 0 }, { 1, 0, 0, 1, 0.875, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  2, { 0, 0, 0, 1, 0.75, 0 }, { 1, 0, 0, 1, 0.75, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  3, { 0, 0, 0, 1, 0.625, 0 }, { 1, 0, 0, 1, 0.625, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  4, { 0, 0, 0, 1, 0.5, 0 }, { 1, 0, 0, 1, 0.5, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  5, { 0, 0, 0, 1, 0.375, 0 }, { 1, 0, 0, 1, 0.375, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  6, { 0, 0, 0, 1, 0.25, 0 }, { 1, 0, 0, 1, 0.25, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  7, { 0, 0, 0, 1, 0.125, 0 }, { 1, 0, 0, 1, 0.125, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  8, { 1, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+  { TRANSITION_FLIP_VERTICAL,  9, { 1, 0, 0, 1, 0.125, 0 }, { 0, 0, 0, 1, 0.125, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 10, { 1, 0, 0, 1, 0.25, 0 }, { 0, 0, 0, 1, 0.25, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 11, { 1, 0, 0, 1, 0.375, 0 }, { 0, 0, 0, 1, 0.375, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 12, { 1, 0, 0, 1, 0.5, 0 }, { 0, 0, 0, 1, 0.5, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 13, { 1, 0, 0, 1, 0.625, 0 }, { 0, 0, 0, 1, 0.625, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 14, { 1, 0, 0, 1, 0.75, 0 }, { 0, 0, 0, 1, 0.75, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 15, { 1, 0, 0, 1, 0.875, 0 }, { 0, 0, 0, 1, 0.875, 0 } },
+  { TRANSITION_FLIP_VERTICAL, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  // TRANSITION_SPIN_LEFT
+  { TRANSITION_SPIN_LEFT,  0, { 0, 0, 0, 1, 1, 360 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_SPIN_LEFT,  1, { 0.0625, 0, 0, 1, 1, 382.5 }, { 0.9375, 0, 0, 1, 1, 22.5 } },
+  { TRANSITION_SPIN_LEFT,  2, { 0.125, 0, 0, 1, 1, 405 }, { 0.875, 0, 0, 1, 1, 45 } },
+  { TRANSITION_SPIN_LEFT,  3, { 0.1875, 0, 0, 1, 1, 427.5 }, { 0.8125, 0, 0, 1, 1, 67.5 } },
+  { TRANSITION_SPIN_LEFT,  4, { 0.25, 0, 0, 1, 1, 450 }, { 0.75, 0, 0, 1, 1, 90 } },
+  { TRANSITION_SPIN_LEFT,  5, { 0.3125, 0, 0, 1, 1, 472.5 }, { 0.6875, 0, 0, 1, 1, 112.5 } },
+  { TRANSITION_SPIN_LEFT,  6, { 0.375, 0, 0, 1, 1, 495 }, { 0.625, 0, 0, 1, 1, 135 } },
+  { TRANSITION_SPIN_LEFT,  7, { 0.4375, 0, 0, 1, 1, 517.5 }, { 0.5625, 0, 0, 1, 1, 157.5 } },
+  { TRANSITION_SPIN_LEFT,  8, { 0.5, 0, 0, 1, 1, 540 }, { 0.5, 0, 0, 1, 1, 180 } },
+  { TRANSITION_SPIN_LEFT,  9, { 0.5625, 0, 0, 1, 1, 562.5 }, { 0.4375, 0, 0, 1, 1, 202.5 } },
+  { TRANSITION_SPIN_LEFT, 10, { 0.625, 0, 0, 1, 1, 585 }, { 0.375, 0, 0, 1, 1, 225 } },
+  { TRANSITION_SPIN_LEFT, 11, { 0.6875, 0, 0, 1, 1, 607.5 }, { 0.3125, 0, 0, 1, 1, 247.5 } },
+  { TRANSITION_SPIN_LEFT, 12, { 0.75, 0, 0, 1, 1, 630 }, { 0.25, 0, 0, 1, 1, 270 } },
+  { TRANSITION_SPIN_LEFT, 13, { 0.8125, 0, 0, 1, 1, 652.5 }, { 0.1875, 0, 0, 1, 1, 292.5 } },
+  { TRANSITION_SPIN_LEFT, 14, { 0.875, 0, 0, 1, 1, 675 }, { 0.125, 0, 0, 1, 1, 315 } },
+  { TRANSITION_SPIN_LEFT, 15, { 0.9375, 0, 0, 1, 1, 697.5 }, { 0.0625, 0, 0, 1, 1, 337.5 } },
+  { TRANSITION_SPIN_LEFT, 16, { 1, 0, 0, 1, 1, 720 }, { 0, 0, 0, 1, 1, 360 } },
+  // TRANSITION_SPIN_RIGHT
+  { TRANSITION_SPIN_RIGHT,  0, { 0, 0, 0, 1, 1, -360 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_SPIN_RIGHT,  1, { 0.0625, 0, 0, 1, 1, -382.5 }, { 0.9375, 0, 0, 1, 1, -22.5 } },
+  { TRANSITION_SPIN_RIGHT,  2, { 0.125, 0, 0, 1, 1, -405 }, { 0.875, 0, 0, 1, 1, -45 } },
+  { TRANSITION_SPIN_RIGHT,  3, { 0.1875, 0, 0, 1, 1, -427.5 }, { 0.8125, 0, 0, 1, 1, -67.5 } },
+  { TRANSITION_SPIN_RIGHT,  4, { 0.25, 0, 0, 1, 1, -450 }, { 0.75, 0, 0, 1, 1, -90 } },
+  { TRANSITION_SPIN_RIGHT,  5, { 0.3125, 0, 0, 1, 1, -472.5 }, { 0.6875, 0, 0, 1, 1, -112.5 } },
+  { TRANSITION_SPIN_RIGHT,  6, { 0.375, 0, 0, 1, 1, -495 }, { 0.625, 0, 0, 1, 1, -135 } },
+  { TRANSITION_SPIN_RIGHT,  7, { 0.4375, 0, 0, 1, 1, -517.5 }, { 0.5625, 0, 0, 1, 1, -157.5 } },
+  { TRANSITION_SPIN_RIGHT,  8, { 0.5, 0, 0, 1, 1, -540 }, { 0.5, 0, 0, 1, 1, -180 } },
+  { TRANSITION_SPIN_RIGHT,  9, { 0.5625, 0, 0, 1, 1, -562.5 }, { 0.4375, 0, 0, 1, 1, -202.5 } },
+  { TRANSITION_SPIN_RIGHT, 10, { 0.625, 0, 0, 1, 1, -585 }, { 0.375, 0, 0, 1, 1, -225 } },
+  { TRANSITION_SPIN_RIGHT, 11, { 0.6875, 0, 0, 1, 1, -607.5 }, { 0.3125, 0, 0, 1, 1, -247.5 } },
+  { TRANSITION_SPIN_RIGHT, 12, { 0.75, 0, 0, 1, 1, -630 }, { 0.25, 0, 0, 1, 1, -270 } },
+  { TRANSITION_SPIN_RIGHT, 13, { 0.8125, 0, 0, 1, 1, -652.5 }, { 0.1875, 0, 0, 1, 1, -292.5 } },
+  { TRANSITION_SPIN_RIGHT, 14, { 0.875, 0, 0, 1, 1, -675 }, { 0.125, 0, 0, 1, 1, -315 } },
+  { TRANSITION_SPIN_RIGHT, 15, { 0.9375, 0, 0, 1, 1, -697.5 }, { 0.0625, 0, 0, 1, 1, -337.5 } },
+  { TRANSITION_SPIN_RIGHT, 16, { 1, 0, 0, 1, 1, -720 }, { 0, 0, 0, 1, 1, -360 } },
+  // TRANSITION_SPIN_LEFT_HALF
+  { TRANSITION_SPIN_LEFT_HALF,  0, { 0, 0, 0, 1, 1, 180 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_SPIN_LEFT_HALF,  1, { 0.0625, 0, 0, 1, 1, 191.25 }, { 0.9375, 0, 0, 1, 1, 11.25 } },
+  { TRANSITION_SPIN_LEFT_HALF,  2, { 0.125, 0, 0, 1, 1, 202.5 }, { 0.875, 0, 0, 1, 1, 22.5 } },
+  { TRANSITION_SPIN_LEFT_HALF,  3, { 0.1875, 0, 0, 1, 1, 213.75 }, { 0.8125, 0, 0, 1, 1, 33.75 } },
+  { TRANSITION_SPIN_LEFT_HALF,  4, { 0.25, 0, 0, 1, 1, 225 }, { 0.75, 0, 0, 1, 1, 45 } },
+  { TRANSITION_SPIN_LEFT_HALF,  5, { 0.3125, 0, 0, 1, 1, 236.25 }, { 0.6875, 0, 0, 1, 1, 56.25 } },
+  { TRANSITION_SPIN_LEFT_HALF,  6, { 0.375, 0, 0, 1, 1, 247.5 }, { 0.625, 0, 0, 1, 1, 67.5 } },
+  { TRANSITION_SPIN_LEFT_HALF,  7, { 0.4375, 0, 0, 1, 1, 258.75 }, { 0.5625, 0, 0, 1, 1, 78.75 } },
+  { TRANSITION_SPIN_LEFT_HALF,  8, { 0.5, 0, 0, 1, 1, 270 }, { 0.5, 0, 0, 1, 1, 90 } },
+  { TRANSITION_SPIN_LEFT_HALF,  9, { 0.5625, 0, 0, 1, 1, 281.25 }, { 0.4375, 0, 0, 1, 1, 101.25 } },
+  { TRANSITION_SPIN_LEFT_HALF, 10, { 0.625, 0, 0, 1, 1, 292.5 }, { 0.375, 0, 0, 1, 1, 112.5 } },
+  { TRANSITION_SPIN_LEFT_HALF, 11, { 0.6875, 0, 0, 1, 1, 303.75 }, { 0.3125, 0, 0, 1, 1, 123.75 } },
+  { TRANSITION_SPIN_LEFT_HALF, 12, { 0.75, 0, 0, 1, 1, 315 }, { 0.25, 0, 0, 1, 1, 135 } },
+  { TRANSITION_SPIN_LEFT_HALF, 13, { 0.8125, 0, 0, 1, 1, 326.25 }, { 0.1875, 0, 0, 1, 1, 146.25 } },
+  { TRANSITION_SPIN_LEFT_HALF, 14, { 0.875, 0, 0, 1, 1, 337.5 }, { 0.125, 0, 0, 1, 1, 157.5 } },
+  { TRANSITION_SPIN_LEFT_HALF, 15, { 0.9375, 0, 0, 1, 1, 348.75 }, { 0.0625, 0, 0, 1, 1, 168.75 } },
+  { TRANSITION_SPIN_LEFT_HALF, 16, { 1, 0, 0, 1, 1, 360 }, { 0, 0, 0, 1, 1, 180 } },
+  // TRANSITION_SPIN_RIGHT_HALF
+  { TRANSITION_SPIN_RIGHT_HALF,  0, { 0, 0, 0, 1, 1, -180 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  1, { 0.0625, 0, 0, 1, 1, -191.25 }, { 0.9375, 0, 0, 1, 1, -11.25 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  2, { 0.125, 0, 0, 1, 1, -202.5 }, { 0.875, 0, 0, 1, 1, -22.5 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  3, { 0.1875, 0, 0, 1, 1, -213.75 }, { 0.8125, 0, 0, 1, 1, -33.75 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  4, { 0.25, 0, 0, 1, 1, -225 }, { 0.75, 0, 0, 1, 1, -45 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  5, { 0.3125, 0, 0, 1, 1, -236.25 }, { 0.6875, 0, 0, 1, 1, -56.25 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  6, { 0.375, 0, 0, 1, 1, -247.5 }, { 0.625, 0, 0, 1, 1, -67.5 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  7, { 0.4375, 0, 0, 1, 1, -258.75 }, { 0.5625, 0, 0, 1, 1, -78.75 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  8, { 0.5, 0, 0, 1, 1, -270 }, { 0.5, 0, 0, 1, 1, -90 } },
+  { TRANSITION_SPIN_RIGHT_HALF,  9, { 0.5625, 0, 0, 1, 1, -281.25 }, { 0.4375, 0, 0, 1, 1, -101.25 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 10, { 0.625, 0, 0, 1, 1, -292.5 }, { 0.375, 0, 0, 1, 1, -112.5 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 11, { 0.6875, 0, 0, 1, 1, -303.75 }, { 0.3125, 0, 0, 1, 1, -123.75 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 12, { 0.75, 0, 0, 1, 1, -315 }, { 0.25, 0, 0, 1, 1, -135 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 13, { 0.8125, 0, 0, 1, 1, -326.25 }, { 0.1875, 0, 0, 1, 1, -146.25 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 14, { 0.875, 0, 0, 1, 1, -337.5 }, { 0.125, 0, 0, 1, 1, -157.5 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 15, { 0.9375, 0, 0, 1, 1, -348.75 }, { 0.0625, 0, 0, 1, 1, -168.75 } },
+  { TRANSITION_SPIN_RIGHT_HALF, 16, { 1, 0, 0, 1, 1, -360 }, { 0, 0, 0, 1, 1, -180 } },
+  // TRANSITION_SHRINK
+  { TRANSITION_SHRINK,  0, { 0, 0, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_SHRINK,  1, { 0, 0, 0, 0.875, 0.875, 0 }, { 1, 0, 0, 0.875, 0.875, 0 } },
+  { TRANSITION_SHRINK,  2, { 0, 0, 0, 0.75, 0.75, 0 }, { 1, 0, 0, 0.75, 0.75, 0 } },
+  { TRANSITION_SHRINK,  3, { 0, 0, 0, 0.625, 0.625, 0 }, { 1, 0, 0, 0.625, 0.625, 0 } },
+  { TRANSITION_SHRINK,  4, { 0, 0, 0, 0.5, 0.5, 0 }, { 1, 0, 0, 0.5, 0.5, 0 } },
+  { TRANSITION_SHRINK,  5, { 0, 0, 0, 0.375, 0.375, 0 }, { 1, 0, 0, 0.375, 0.375, 0 } },
+  { TRANSITION_SHRINK,  6, { 0, 0, 0, 0.25, 0.25, 0 }, { 1, 0, 0, 0.25, 0.25, 0 } },
+  { TRANSITION_SHRINK,  7, { 0, 0, 0, 0.125, 0.125, 0 }, { 1, 0, 0, 0.125, 0.125, 0 } },
+  { TRANSITION_SHRINK,  8, { 1, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+  { TRANSITION_SHRINK,  9, { 1, 0, 0, 0.125, 0.125, 0 }, { 0, 0, 0, 0.125, 0.125, 0 } },
+  { TRANSITION_SHRINK, 10, { 1, 0, 0, 0.25, 0.25, 0 }, { 0, 0, 0, 0.25, 0.25, 0 } },
+  { TRANSITION_SHRINK, 11, { 1, 0, 0, 0.375, 0.375, 0 }, { 0, 0, 0, 0.375, 0.375, 0 } },
+  { TRANSITION_SHRINK, 12, { 1, 0, 0, 0.5, 0.5, 0 }, { 0, 0, 0, 0.5, 0.5, 0 } },
+  { TRANSITION_SHRINK, 13, { 1, 0, 0, 0.625, 0.625, 0 }, { 0, 0, 0, 0.625, 0.625, 0 } },
+  { TRANSITION_SHRINK, 14, { 1, 0, 0, 0.75, 0.75, 0 }, { 0, 0, 0, 0.75, 0.75, 0 } },
+  { TRANSITION_SHRINK, 15, { 1, 0, 0, 0.875, 0.875, 0 }, { 0, 0, 0, 0.875, 0.875, 0 } },
+  { TRANSITION_SHRINK, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 0, 1, 1, 0 } },
+  // TRANSITION_PUSH_UP
+  { TRANSITION_PUSH_UP,  0, { 0, 0, -17, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  1, { 0.0625, 0, -15.9375, 1, 1, 0 }, { 0.9375, 0, 1.0625, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  2, { 0.125, 0, -14.875, 1, 1, 0 }, { 0.875, 0, 2.125, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  3, { 0.1875, 0, -13.8125, 1, 1, 0 }, { 0.8125, 0, 3.1875, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  4, { 0.25, 0, -12.75, 1, 1, 0 }, { 0.75, 0, 4.25, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  5, { 0.3125, 0, -11.6875, 1, 1, 0 }, { 0.6875, 0, 5.3125, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  6, { 0.375, 0, -10.625, 1, 1, 0 }, { 0.625, 0, 6.375, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  7, { 0.4375, 0, -9.5625, 1, 1, 0 }, { 0.5625, 0, 7.4375, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  8, { 0.5, 0, -8.5, 1, 1, 0 }, { 0.5, 0, 8.5, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP,  9, { 0.5625, 0, -7.4375, 1, 1, 0 }, { 0.4375, 0, 9.5625, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 10, { 0.625, 0, -6.375, 1, 1, 0 }, { 0.375, 0, 10.625, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 11, { 0.6875, 0, -5.3125, 1, 1, 0 }, { 0.3125, 0, 11.6875, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 12, { 0.75, 0, -4.25, 1, 1, 0 }, { 0.25, 0, 12.75, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 13, { 0.8125, 0, -3.1875, 1, 1, 0 }, { 0.1875, 0, 13.8125, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 14, { 0.875, 0, -2.125, 1, 1, 0 }, { 0.125, 0, 14.875, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 15, { 0.9375, 0, -1.0625, 1, 1, 0 }, { 0.0625, 0, 15.9375, 1, 1, 0 } },
+  { TRANSITION_PUSH_UP, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, 17, 1, 1, 0 } },
+  // TRANSITION_PUSH_DOWN
+  { TRANSITION_PUSH_DOWN,  0, { 0, 0, 17, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  1, { 0.0625, 0, 15.9375, 1, 1, 0 }, { 0.9375, 0, -1.0625, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  2, { 0.125, 0, 14.875, 1, 1, 0 }, { 0.875, 0, -2.125, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  3, { 0.1875, 0, 13.8125, 1, 1, 0 }, { 0.8125, 0, -3.1875, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  4, { 0.25, 0, 12.75, 1, 1, 0 }, { 0.75, 0, -4.25, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  5, { 0.3125, 0, 11.6875, 1, 1, 0 }, { 0.6875, 0, -5.3125, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  6, { 0.375, 0, 10.625, 1, 1, 0 }, { 0.625, 0, -6.375, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  7, { 0.4375, 0, 9.5625, 1, 1, 0 }, { 0.5625, 0, -7.4375, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  8, { 0.5, 0, 8.5, 1, 1, 0 }, { 0.5, 0, -8.5, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN,  9, { 0.5625, 0, 7.4375, 1, 1, 0 }, { 0.4375, 0, -9.5625, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 10, { 0.625, 0, 6.375, 1, 1, 0 }, { 0.375, 0, -10.625, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 11, { 0.6875, 0, 5.3125, 1, 1, 0 }, { 0.3125, 0, -11.6875, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 12, { 0.75, 0, 4.25, 1, 1, 0 }, { 0.25, 0, -12.75, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 13, { 0.8125, 0, 3.1875, 1, 1, 0 }, { 0.1875, 0, -13.8125, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 14, { 0.875, 0, 2.125, 1, 1, 0 }, { 0.125, 0, -14.875, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 15, { 0.9375, 0, 1.0625, 1, 1, 0 }, { 0.0625, 0, -15.9375, 1, 1, 0 } },
+  { TRANSITION_PUSH_DOWN, 16, { 1, 0, 0, 1, 1, 0 }, { 0, 0, -17, 1, 1, 0 } },
+  // TRANSITION_PUSH_LEFT
+  { TRANSITION_PUSH_LEFT,  0, { 1, 12, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  1, { 1, 11.25, 0, 1, 1, 0 }, { 1, -0.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  2, { 1, 10.5, 0, 1, 1, 0 }, { 1, -1.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  3, { 1, 9.75, 0, 1, 1, 0 }, { 1, -2.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  4, { 1, 9, 0, 1, 1, 0 }, { 1, -3, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  5, { 1, 8.25, 0, 1, 1, 0 }, { 1, -3.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  6, { 1, 7.5, 0, 1, 1, 0 }, { 1, -4.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  7, { 1, 6.75, 0, 1, 1, 0 }, { 1, -5.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  8, { 1, 6, 0, 1, 1, 0 }, { 1, -6, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT,  9, { 1, 5.25, 0, 1, 1, 0 }, { 1, -6.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 10, { 1, 4.5, 0, 1, 1, 0 }, { 1, -7.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 11, { 1, 3.75, 0, 1, 1, 0 }, { 1, -8.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 12, { 1, 3, 0, 1, 1, 0 }, { 1, -9, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 13, { 1, 2.25, 0, 1, 1, 0 }, { 1, -9.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 14, { 1, 1.5, 0, 1, 1, 0 }, { 1, -10.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 15, { 1, 0.75, 0, 1, 1, 0 }, { 1, -11.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_LEFT, 16, { 1, 0, 0, 1, 1, 0 }, { 1, -12, 0, 1, 1, 0 } },
+  // TRANSITION_PUSH_RIGHT
+  { TRANSITION_PUSH_RIGHT,  0, { 1, -12, 0, 1, 1, 0 }, { 1, 0, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  1, { 1, -11.25, 0, 1, 1, 0 }, { 1, 0.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  2, { 1, -10.5, 0, 1, 1, 0 }, { 1, 1.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  3, { 1, -9.75, 0, 1, 1, 0 }, { 1, 2.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  4, { 1, -9, 0, 1, 1, 0 }, { 1, 3, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  5, { 1, -8.25, 0, 1, 1, 0 }, { 1, 3.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  6, { 1, -7.5, 0, 1, 1, 0 }, { 1, 4.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  7, { 1, -6.75, 0, 1, 1, 0 }, { 1, 5.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  8, { 1, -6, 0, 1, 1, 0 }, { 1, 6, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT,  9, { 1, -5.25, 0, 1, 1, 0 }, { 1, 6.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 10, { 1, -4.5, 0, 1, 1, 0 }, { 1, 7.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 11, { 1, -3.75, 0, 1, 1, 0 }, { 1, 8.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 12, { 1, -3, 0, 1, 1, 0 }, { 1, 9, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 13, { 1, -2.25, 0, 1, 1, 0 }, { 1, 9.75, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 14, { 1, -1.5, 0, 1, 1, 0 }, { 1, 10.5, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 15, { 1, -0.75, 0, 1, 1, 0 }, { 1, 11.25, 0, 1, 1, 0 } },
+  { TRANSITION_PUSH_RIGHT, 16, { 1, 0, 0, 1, 1, 0 }, { 1, 12, 0, 1, 1, 0 } },
+};
@@ -0,0 +1,239 @@
+"""
+SuperPixie font compiler
+
+Turns the editable glyph source in font/ascii_font.json into the flash-resident font tables in
+examples/SUPERPIXIE_FIRMWARE/ascii.h, in the format the firmware's rasterizer reads directly:
+
+  font_glyphs[]   - One entry per printable ASCII character (33-126), indexed by (c - 33)
+  font_vertices[] - Every glyph's vertices as vec2D floats, already scaled to LED units
+  font_lines[]    - Every glyph's line segments, as pairs of indices into that glyph's vertices
+
+Vertices that appear more than once in a glyph are merged, and lines that end up repeated or
+zero-length after merging are dropped, so each vertex only has to be transformed once per frame.
+
+Usage:
+  python font_compiler.py                      Compile font/ascii_font.json into ascii.h
+  python font_compiler.py --import OLD_ASCII_H Recreate font/ascii_font.json from a legacy ascii.h
+                                               that still has the packed ascii_font[] byte array
+"""
+
+import argparse
+import json
+import os
+import re
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_PATH = os.path.join(SCRIPT_DIR, "font", "ascii_font.json")
+OUTPUT_PATH = os.path.join(SCRIPT_DIR, "..", "examples", "SUPERPIXIE_FIRMWARE", "ascii.h")
+
+FIRST_CHARACTER = 33  # '!', everything at or below ' ' draws nothing
+LAST_CHARACTER = 126  # '~'
+
+COORDINATE_DECIMALS = 2  # The legacy font stored every coordinate x100
+
+
+def import_legacy_font(path):
+    """Decode the packed big-endian ascii_font[] array of a legacy ascii.h into glyph sources"""
+    with open(path, "r") as f:
+        text = f.read()
+
+    body = text[text.index("ascii_font["):]
+    body = body[body.index("{") + 1:body.index("};")]
+
+    glyphs = []
+    name = None
+    for raw_line in body.splitlines():
+        raw_line = raw_line.strip()
+        comment = re.match(r"//\s*(\w+)", raw_line)
+        if comment:
+            name = comment.group(1).replace("_polygon", "")
+            continue
+
+        values = [int(v) for v in raw_line.split(",") if v.strip() != ""]
+        if len(values) == 0:
+            continue
+
+        glyphs.append((name, values))
+
+    def int16(data, i):
+        value = (data[i] << 8) + data[i + 1]
+        return value - 65536 if value >= 32768 else value
+
+    sources = []
+    for index, (name, data) in enumerate(glyphs):
+        character = FIRST_CHARACTER + index
+        if character > LAST_CHARACTER:
+            break  # The legacy font ends with an unreachable "empty" glyph
+
+        num_bytes = int16(data, 0)
+        num_verts = int16(data, 2)
+
+        vertices = []
+        for v in range(num_verts):
+            x = int16(data, 6 + v * 4) / 100.0
+            y = int16(data, 6 + v * 4 + 2) / 100.0
+            vertices.append([x, y])
+
+        lines = []
+        for i in range(6 + num_verts * 4, num_bytes, 4):
+            lines.append([int16(data, i), int16(data, i + 2)])
+
+        sources.append({
+            "character": chr(character),
+            "name": name,
+            "vertices": vertices,
+            "lines": lines,
+        })
+
+    return sources
+
+
+def compile_glyph(source):
+    """Merge duplicate vertices and drop repeated or degenerate lines"""
+    vertices = []
+    vertex_lookup = {}
+    remap = []
+
+    for x, y in source["vertices"]:
+        key = (round(x, COORDINATE_DECIMALS), round(y, COORDINATE_DECIMALS))
+        if key not in vertex_lookup:
+            vertex_lookup[key] = len(vertices)
+            vertices.append(key)
+        remap.append(vertex_lookup[key])
+
+    lines = []
+    seen = set()
+    for start, end in source["lines"]:
+        start = remap[start]
+        end = remap[end]
+        key = (min(start, end), max(start, end))
+        if start == end or key in seen:
+            continue
+        seen.add(key)
+        lines.append((start, end))
+
+    if len(vertices) > 255 or len(lines) > 255:
+        raise ValueError("Glyph '%s' is too complex for the 8-bit font tables" % source["character"])
+
+    return vertices, lines
+
+
+def format_float(value):
+    return ("%." + str(COORDINATE_DECIMALS) + "f") % value
+
+
+def character_comment(character):
+    if character == "\\":
+        return "back slash"
+    return character
+
+
+def write_header(sources, path):
+    by_character = {source["character"]: source for source in sources}
+
+    glyph_rows = []
+    vertex_rows = []
+    line_rows = []
+    num_vertices = 0
+    num_lines = 0
+    max_vertices = 0
+    max_lines = 0
+    all_x = [0.0]
+    all_y = [0.0]
+
+    for c in range(FIRST_CHARACTER, LAST_CHARACTER + 1):
+        source = by_character.get(chr(c), {"vertices": [], "lines": [], "name": "missing"})
+        vertices, lines = compile_glyph(source)
+
+        glyph_rows.append("  { %5d, %5d, %3d, %3d },  // %s" % (
+            num_vertices, num_lines, len(vertices), len(lines), character_comment(chr(c))))
+
+        vertex_rows.append("  // %s" % source["name"])
+        for i in range(0, len(vertices), 4):
+            vertex_rows.append("  " + " ".join("{ %s, %s }," % (format_float(x), format_float(y)) for x, y in vertices[i:i + 4]))
+
+        line_rows.append("  // %s" % source["name"])
+        for i in range(0, len(lines), 8):
+            line_rows.append("  " + " ".join("{ %d, %d }," % line for line in lines[i:i + 8]))
+
+        num_vertices += len(vertices)
+        num_lines += len(lines)
+        max_vertices = max(max_vertices, len(vertices))
+        max_lines = max(max_lines, len(lines))
+        all_x.extend(x for x, y in vertices)
+        all_y.extend(y for x, y in vertices)
+
+    output = []
+    output.append("// #############################################################################################")
+    output.append("// GENERATED FILE - DO NOT EDIT BY HAND")
+    output.append("// Built by scripts/font_compiler.py from scripts/font/ascii_font.json, edit the glyphs there")
+    output.append("// and rerun the compiler.")
+    output.append("//")
+    output.append("// The tables are const PROGMEM, so they stay in flash (memory-mapped on the ESP32) instead of")
+    output.append("// being copied into RAM, and are already in the format the rasterizer reads: see")
+    output.append("// get_font_glyph() in glyph_cache.h for how to find a character.")
+    output.append("// #############################################################################################")
+    output.append("")
+    output.append("#define FONT_FIRST_CHARACTER %d" % FIRST_CHARACTER)
+    output.append("#define FONT_NUM_GLYPHS %d" % (LAST_CHARACTER - FIRST_CHARACTER + 1))
+    output.append("#define FONT_NUM_VERTICES %d" % num_vertices)
+    output.append("#define FONT_NUM_LINES %d" % num_lines)
+    output.append("#define FONT_MAX_GLYPH_VERTICES %d  // Most vertices in any single glyph" % max_vertices)
+    output.append("#define FONT_MAX_GLYPH_LINES %d  // Most lines in any single glyph" % max_lines)
+    output.append("")
+    output.append("// Bounding box of every vertex in the font")
+    output.append("#define FONT_MIN_X (%s)" % format_float(min(all_x)))
+    output.append("#define FONT_MAX_X (%s)" % format_float(max(all_x)))
+    output.append("#define FONT_MIN_Y (%s)" % format_float(min(all_y)))
+    output.append("#define FONT_MAX_Y (%s)" % format_float(max(all_y)))
+    output.append("")
+    output.append("// One entry per character, starting at FONT_FIRST_CHARACTER")
+    output.append("const font_glyph font_glyphs[FONT_NUM_GLYPHS] PROGMEM = {")
+    output.append("  // first_vertex, first_line, num_vertices, num_lines")
+    output.extend(glyph_rows)
+    output.append("};")
+    output.append("")
+    output.append("// Glyph vertices in LED units, centered on the middle of the display")
+    output.append("const vec2D font_vertices[FONT_NUM_VERTICES] PROGMEM = {")
+    output.extend(vertex_rows)
+    output.append("};")
+    output.append("")
+    output.append("// Glyph line segments, as indices relative to the glyph's first_vertex")
+    output.append("const font_line font_lines[FONT_NUM_LINES] PROGMEM = {")
+    output.extend(line_rows)
+    output.append("};")
+    output.append("")
+
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(output))
+
+    print("Wrote %s: %d glyphs, %d vertices, %d lines (%d bytes of flash)" % (
+        os.path.normpath(path), LAST_CHARACTER - FIRST_CHARACTER + 1, num_vertices, num_lines,
+        (LAST_CHARACTER - FIRST_CHARACTER + 1) * 6 + num_vertices * 8 + num_lines * 2))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SuperPixie font compiler")
+    parser.add_argument("--import", dest="import_path", help="legacy ascii.h to recreate the glyph source from")
+    parser.add_argument("--source", default=SOURCE_PATH, help="glyph source JSON")
+    parser.add_argument("--output", default=OUTPUT_PATH, help="generated header")
+    args = parser.parse_args()
+
+    if args.import_path:
+        sources = import_legacy_font(args.import_path)
+        os.makedirs(os.path.dirname(args.source), exist_ok=True)
+        with open(args.source, "w", newline="\n") as f:
+            f.write("[\n")
+            f.write(",\n".join("  " + json.dumps(source) for source in sources))
+            f.write("\n]\n")
+        print("Imported %d glyphs into %s" % (len(sources), os.path.normpath(args.source)))
+        return
+
+    with open(args.source, "r") as f:
+        sources = json.load(f)
+
+    write_header(sources, args.output)
+
+
+if __name__ == "__main__":
+    main()
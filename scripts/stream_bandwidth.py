@@ -0,0 +1,88 @@
+"""
+SuperPixie stream bandwidth calculator
+
+Works out how many frames per second SuperPixie::stream_frame() can reach, for a given number
+of nodes and chain baud rate, in each of the stream encodings (see stream.h in the firmware):
+
+  rgb     - 3 bytes per pixel
+  palette - 4-bit palette indices, two pixels per byte
+  rle     - one byte per run of up to 16 pixels of the same palette entry, so its size depends
+            on the frame, estimated here with --rle-runs
+
+Every node is sent its own frame, and every packet crosses the whole chain, so the chain's
+bandwidth is shared between all of them. Each packet costs 20 bytes of framing on the wire
+(preamble, header, outro) plus 2 bytes for every data byte, since data is nibble encoded, and
+every byte on the wire is 10 bits with its start and stop bits.
+
+Usage:
+  python stream_bandwidth.py                            Table for the default node counts and bauds
+  python stream_bandwidth.py --nodes 8 --baud 115200    A single chain configuration
+"""
+
+import argparse
+import math
+
+FRAME_WIDTH = 7
+FRAME_HEIGHT = 15
+FRAME_PIXELS = FRAME_WIDTH * FRAME_HEIGHT
+
+FRAGMENT_HEADER = 3       # Sequence number, encoding, first pixel
+MAX_FRAGMENT_DATA = 51    # STREAM_MAX_FRAGMENT_DATA
+PACKET_OVERHEAD = 20      # Wire bytes per packet besides its data
+BITS_PER_WIRE_BYTE = 10   # 8N1
+
+DEFAULT_NODES = [1, 2, 4, 8, 16, 32]
+DEFAULT_BAUDS = [9600, 57600, 115200, 250000]  # The firmware's chain runs at 9600 baud today
+
+
+def fragment_sizes(data_bytes, unit):
+    """Split (data_bytes) of frame data into fragments, never splitting a (unit) sized group"""
+    per_fragment = (MAX_FRAGMENT_DATA // unit) * unit
+    sizes = []
+    while data_bytes > 0:
+        sizes.append(min(per_fragment, data_bytes))
+        data_bytes -= sizes[-1]
+    return sizes
+
+
+def wire_bytes_per_frame(encoding, rle_runs):
+    """Bytes on the wire to send one whole frame to one node"""
+    if encoding == "rgb":
+        sizes = fragment_sizes(FRAME_PIXELS * 3, 3)
+    elif encoding == "palette":
+        sizes = fragment_sizes(math.ceil(FRAME_PIXELS / 2), 1)
+    else:
+        sizes = fragment_sizes(rle_runs, 1)
+
+    return sum(PACKET_OVERHEAD + 2 * (FRAGMENT_HEADER + size) for size in sizes)
+
+
+def frames_per_second(encoding, nodes, baud, rle_runs):
+    wire_bytes = wire_bytes_per_frame(encoding, rle_runs) * nodes
+    return baud / BITS_PER_WIRE_BYTE / wire_bytes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SuperPixie stream bandwidth calculator")
+    parser.add_argument("--nodes", type=int, nargs="+", default=DEFAULT_NODES, help="number of nodes streamed to")
+    parser.add_argument("--baud", type=int, nargs="+", default=DEFAULT_BAUDS, help="chain baud rate")
+    parser.add_argument("--rle-runs", type=int, default=24, help="runs per frame for the rle estimate (%d at most)" % FRAME_PIXELS)
+    args = parser.parse_args()
+
+    rle_runs = max(math.ceil(FRAME_PIXELS / 16), min(args.rle_runs, FRAME_PIXELS))
+    encodings = ["rgb", "palette", "rle"]
+
+    for encoding in encodings:
+        print("%-8s %4d wire bytes per frame per node" % (encoding, wire_bytes_per_frame(encoding, rle_runs)))
+    print("(rle assumes %d runs per frame)" % rle_runs)
+    print()
+
+    print("%6s %8s" % ("nodes", "baud") + "".join("%10s" % encoding for encoding in encodings) + "   (fps)")
+    for nodes in args.nodes:
+        for baud in args.baud:
+            row = "".join("%10.2f" % frames_per_second(encoding, nodes, baud, rle_runs) for encoding in encodings)
+            print("%6d %8d" % (nodes, baud) + row)
+
+
+if __name__ == "__main__":
+    main()
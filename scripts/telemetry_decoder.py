@@ -0,0 +1,211 @@
+"""
+SuperPixie telemetry decoder
+
+Reads the binary telemetry records a SuperPixie sends from its right hand serial port (see
+telemetry.h in the firmware) and writes them out as CSV, one column per field and one row per
+record, ready for a spreadsheet or pandas.
+
+The firmware describes its own fields with a schema record every so often, so this script never
+needs updating when fields are added. Records that arrive before the first schema are skipped.
+Each schema gets its own file, named after its ID, so logs from before and after a firmware
+update never share columns.
+
+Usage:
+  python telemetry_decoder.py --port COM24                 Log a live node to telemetry_<id>.csv
+  python telemetry_decoder.py --port /dev/ttyUSB0 --raw capture.bin
+                                                           Also keep the raw bytes
+  python telemetry_decoder.py --input capture.bin          Decode a saved capture
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+from datetime import datetime
+
+TELEMETRY_VERSION = 1
+SYNC = b"\xA5\x5A"
+HEADER_SIZE = 6            # Sync bytes, version, record type, payload length
+CHECKSUM_SIZE = 2
+MAX_PAYLOAD = 4096         # Anything longer is a false sync
+
+RECORD_SCHEMA = 0
+RECORD_DATA = 1
+
+# telemetry_types, as struct formats
+TYPE_FORMATS = ["?", "B", "H", "I", "i", "f"]
+
+
+def crc16(data):
+    """CRC-16 (CCITT), as get_telemetry_checksum() in the firmware"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            if crc & 0x8000:
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF
+            else:
+                crc = (crc << 1) & 0xFFFF
+    return crc
+
+
+class TelemetryDecoder:
+    """Splits a byte stream into records, resyncing on the sync bytes after any corruption"""
+
+    def __init__(self, output_stem, echo):
+        self.buffer = bytearray()
+        self.output_stem = output_stem
+        self.echo = echo
+
+        self.schemas = {}          # Schema ID: (field names, struct for the values)
+        self.writers = {}          # Schema ID: (file, csv writer)
+        self.last_sequence = None
+
+        self.records = 0
+        self.dropped = 0           # Gaps in the sequence numbers
+        self.corrupt = 0
+
+    def feed(self, data):
+        self.buffer += data
+
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                del self.buffer[:-1]  # Keep a trailing first sync byte
+                return
+            del self.buffer[:start]
+
+            if len(self.buffer) < HEADER_SIZE:
+                return
+
+            version, record_type, payload_length = struct.unpack_from("<BBH", self.buffer, 2)
+            if version != TELEMETRY_VERSION or payload_length > MAX_PAYLOAD:
+                self.skip_false_sync()
+                continue
+
+            record_length = HEADER_SIZE + payload_length + CHECKSUM_SIZE
+            if len(self.buffer) < record_length:
+                return
+
+            checksum = struct.unpack_from("<H", self.buffer, HEADER_SIZE + payload_length)[0]
+            if checksum != crc16(self.buffer[2:HEADER_SIZE + payload_length]):
+                self.corrupt += 1
+                self.skip_false_sync()
+                continue
+
+            payload = bytes(self.buffer[HEADER_SIZE:HEADER_SIZE + payload_length])
+            del self.buffer[:record_length]
+
+            if record_type == RECORD_SCHEMA:
+                self.read_schema(payload)
+            elif record_type == RECORD_DATA:
+                self.read_data(payload)
+
+    def skip_false_sync(self):
+        del self.buffer[:1]
+
+    def read_schema(self, payload):
+        schema_id, num_fields = struct.unpack_from("<HB", payload, 0)
+        if schema_id in self.schemas:
+            return
+
+        names = []
+        formats = "<"
+        index = 3
+        for _ in range(num_fields):
+            field_type, name_length = struct.unpack_from("<BB", payload, index)
+            index += 2
+            names.append(payload[index:index + name_length].decode("ascii"))
+            index += name_length
+            formats += TYPE_FORMATS[field_type]
+
+        self.schemas[schema_id] = (names, struct.Struct(formats))
+        print("Schema %04x: %d fields" % (schema_id, num_fields))
+
+    def read_data(self, payload):
+        schema_id, sequence = struct.unpack_from("<HH", payload, 0)
+        if schema_id not in self.schemas:
+            return  # Still waiting for its schema
+
+        names, values_struct = self.schemas[schema_id]
+        values = values_struct.unpack_from(payload, 4)
+
+        if self.last_sequence is not None:
+            self.dropped += (sequence - self.last_sequence - 1) & 0xFFFF
+        self.last_sequence = sequence
+        self.records += 1
+
+        host_time = datetime.now().strftime("%Y-%m-%d %H:%M:%S.%f")[:-3]
+        self.get_writer(schema_id, names).writerow([host_time, sequence] + [format_value(value) for value in values])
+
+        if self.echo:
+            print("%s  #%-5d " % (host_time, sequence) + "  ".join("%s=%s" % (name, format_value(value)) for name, value in zip(names, values)))
+
+    def get_writer(self, schema_id, names):
+        if schema_id not in self.writers:
+            path = "%s_%04x.csv" % (self.output_stem, schema_id)
+            new_file = not os.path.exists(path) or os.path.getsize(path) == 0
+
+            output = open(path, "a", newline="")
+            writer = csv.writer(output)
+            if new_file:
+                writer.writerow(["host_time", "sequence"] + names)
+            self.writers[schema_id] = (output, writer)
+            print("Writing %s" % path)
+
+        output, writer = self.writers[schema_id]
+        output.flush()
+        return writer
+
+    def close(self):
+        for output, _ in self.writers.values():
+            output.close()
+        print("%d records, %d dropped, %d corrupt" % (self.records, self.dropped, self.corrupt))
+
+
+def format_value(value):
+    if isinstance(value, bool):
+        return int(value)
+    if isinstance(value, float):
+        return "%.6g" % value
+    return value
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SuperPixie telemetry decoder")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial port of a live node")
+    source.add_argument("--input", help="raw capture to decode instead")
+    parser.add_argument("--baud", type=int, default=9600, help="the chain's baud rate (DEFAULT_CHAIN_BAUD)")
+    parser.add_argument("--output", default="telemetry", help="CSV file name, before the schema ID")
+    parser.add_argument("--raw", help="also append the raw bytes from the port to this file")
+    parser.add_argument("--echo", action="store_true", help="print every record as it arrives")
+    args = parser.parse_args()
+
+    decoder = TelemetryDecoder(args.output, args.echo)
+
+    try:
+        if args.input:
+            with open(args.input, "rb") as capture:
+                decoder.feed(capture.read())
+        else:
+            import serial  # pyserial, only needed for live nodes
+
+            port = serial.Serial(args.port, args.baud, timeout=0.1)
+            raw = open(args.raw, "ab") if args.raw else None
+            while True:
+                data = port.read(port.in_waiting or 1)
+                if raw:
+                    raw.write(data)
+                decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        decoder.close()
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -106,6 +106,10 @@ void SuperPixie::init_uart(){
 
 // Send command packet to broadcast or a specific address, strictly forcing acknowledgement
 uint16_t SuperPixie::send_packet(uint8_t command_type, uint8_t destination_address, uint8_t data_length_in_bytes, uint8_t* command_data) {
+	if(timeline_recording == true && command_type != COM_TIMELINE_ADD && command_type != COM_TIMELINE_CONTROL){
+		return send_timeline_entry(command_type, destination_address, data_length_in_bytes, command_data);
+	}
+
 	debugln("TX: ");
 	debug("  TYPE:\t");
 	debugln(command_type);
@@ -297,6 +301,20 @@ void SuperPixie::execute_packet(uint8_t origin_address, uint16_t packet_id, uint
 	else if (command_type == COM_TRANSITION_COMPLETE) {
 		show_complete = true;
 	}
+	else if (command_type == COM_FPS_RESPONSE) {
+		if(profile_stages != nullptr && data_length_in_bytes >= 3){
+			uint8_t first_stage = packet_data[0];
+			uint8_t num_stages = packet_data[1];
+			
+			for(uint8_t i = 0; i < num_stages && first_stage + i < NUM_PROFILE_STAGES && 3 + i * 6 + 6 <= data_length_in_bytes; i++){
+				uint8_t* stage_data = &packet_data[3 + i * 6];
+				profile_stages[first_stage + i].min_us = (stage_data[0] << 8) + stage_data[1];
+				profile_stages[first_stage + i].avg_us = (stage_data[2] << 8) + stage_data[3];
+				profile_stages[first_stage + i].p99_us = (stage_data[4] << 8) + stage_data[5];
+				profile_stages_received++;
+			}
+		}
+	}
 }
 
 
@@ -306,6 +324,67 @@ void SuperPixie::set_string( char* string ){
 }
 
 
+void SuperPixie::start_marquee( char* string, float speed, float pitch, bool loop, uint16_t delay_ms ){
+	// Sent once, every node scrolls its own part of the string from then on. Speed is in LEDs per
+	// second and pitch in LEDs from one character to the next.
+	uint8_t length = strlen(string);
+	if( length > MARQUEE_MAX_LENGTH ){
+		length = MARQUEE_MAX_LENGTH;
+	}
+
+	uint16_t speed_x100 = speed * 100;
+	uint8_t pitch_x10 = pitch * 10;
+
+	uint8_t marquee_data[6 + MARQUEE_MAX_LENGTH] = {
+		loop,
+		get_byte_from_16_bit(speed_x100, 1), get_byte_from_16_bit(speed_x100, 0),
+		get_byte_from_16_bit(delay_ms, 1), get_byte_from_16_bit(delay_ms, 0),
+		pitch_x10,
+	};
+	memcpy(&marquee_data[6], string, length);
+
+	send_packet(COM_SET_MARQUEE, ADDRESS_BROADCAST, 6 + length, marquee_data);
+}
+
+
+void SuperPixie::start_clock( const char* format, int32_t base, int16_t step, uint16_t tick_ms, uint16_t delay_ms, bool stop_at_zero, uint8_t first_address ){
+	// Every node shows its own character of (format) from then on, starting with the node at
+	// (first_address). H, I, M and S show digits of (base) as seconds since midnight, D shows the
+	// value itself, and lower case letters leave leading zeros blank: "HH:MM:SS", "hh:MM" or
+	// "ddddd". (step) is added every (tick_ms), the first time (delay_ms) from now.
+	uint8_t length = strlen(format);
+	if( length > CLOCK_MAX_FORMAT ){
+		length = CLOCK_MAX_FORMAT;
+	}
+
+	uint8_t clock_data[12 + CLOCK_MAX_FORMAT] = {
+		stop_at_zero ? CLOCK_FLAG_STOP_AT_ZERO : 0,
+		uint8_t(uint32_t(base) >> 24), uint8_t(uint32_t(base) >> 16), uint8_t(uint32_t(base) >> 8), uint8_t(base),
+		get_byte_from_16_bit(step, 1), get_byte_from_16_bit(step, 0),
+		get_byte_from_16_bit(tick_ms, 1), get_byte_from_16_bit(tick_ms, 0),
+		get_byte_from_16_bit(delay_ms, 1), get_byte_from_16_bit(delay_ms, 0),
+		first_address,
+	};
+	memcpy(&clock_data[12], format, length);
+
+	send_packet(COM_SET_CLOCK, ADDRESS_BROADCAST, 12 + length, clock_data);
+}
+
+
+void SuperPixie::stop_clock(){
+	// An empty format stops the clock, leaving whatever it showed last on screen
+	uint8_t clock_data[12] = { 0, 0, 0, 0, 0, 0, 0, 0x03, 0xE8, 0, 0, 0 };
+	send_packet(COM_SET_CLOCK, ADDRESS_BROADCAST, 12, clock_data);
+}
+
+
+void SuperPixie::stop_marquee(){
+	// An empty string puts every node back to the character it showed before
+	uint8_t marquee_data[6] = { 0, 0, 1, 0, 0, 1 };
+	send_packet(COM_SET_MARQUEE, ADDRESS_BROADCAST, 6, marquee_data);
+}
+
+
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // %% FUNCTIONS - UPDATING THE MASK / LEDS %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -389,6 +468,12 @@ void SuperPixie::clear(){
 
 
 void SuperPixie::show(){
+	// Recorded shows run later on the nodes, so there's nothing to wait for or rate limit
+	if(timeline_recording == true){
+		send_packet(COM_SHOW, ADDRESS_BROADCAST, 0, nullptr);
+		return;
+	}
+
 	static uint32_t t_us_last = micros();
 	uint32_t t_us_now = micros();
 	
@@ -400,6 +485,27 @@ void SuperPixie::show(){
 	}
 }
 
+bool SuperPixie::get_profile( uint8_t destination_address, stage_profile* stages, bool reset ){
+	// Ask one node for the timing of every stage of its frame, filling (stages) with
+	// NUM_PROFILE_STAGES entries. With (reset), the node starts counting again afterwards.
+	// Returns false if the node didn't answer in time.
+	profile_stages_received = 0;
+	profile_stages = stages;
+
+	uint8_t reset_data[1] = { reset };
+	send_packet(COM_GET_FPS, destination_address, 1, reset_data);
+
+	const uint32_t profile_timeout_ms = 1000;
+	uint32_t t_start = millis();
+	while(millis() - t_start <= profile_timeout_ms && profile_stages_received < NUM_PROFILE_STAGES){
+		yield();
+	}
+
+	profile_stages = nullptr;
+	return profile_stages_received >= NUM_PROFILE_STAGES;
+}
+
+
 void SuperPixie::wait(){
 	const uint32_t wait_timeout_ms = 10000;
 	uint32_t t_start = millis();
@@ -418,6 +524,92 @@ void SuperPixie::wait(){
 
 
 
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// %% FUNCTIONS - TIMELINES %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void SuperPixie::begin_timeline( bool clear_first, uint8_t destination_address ){
+	// Every command sent from now until end_timeline() is added to the nodes' timelines at the
+	// time set with set_timeline_time(), instead of running right away
+	if( clear_first == true ){
+		clear_timeline(destination_address);
+	}
+
+	timeline_time_ms = 0;
+	timeline_recording = true;
+}
+
+
+void SuperPixie::set_timeline_time( uint32_t time_ms ){
+	timeline_time_ms = time_ms;
+}
+
+
+void SuperPixie::end_timeline(){
+	timeline_recording = false;
+}
+
+
+void SuperPixie::play_timeline( bool loop, uint32_t length_ms, uint32_t position_ms, uint8_t destination_address ){
+	send_timeline_control(TIMELINE_PLAY, loop ? TIMELINE_FLAG_LOOP : 0, position_ms, length_ms, destination_address);
+}
+
+
+void SuperPixie::pause_timeline( uint8_t destination_address ){
+	send_timeline_control(TIMELINE_PAUSE, 0, 0, 0, destination_address);
+}
+
+
+void SuperPixie::resume_timeline( uint8_t destination_address ){
+	send_timeline_control(TIMELINE_RESUME, 0, 0, 0, destination_address);
+}
+
+
+void SuperPixie::seek_timeline( uint32_t position_ms, uint8_t destination_address ){
+	send_timeline_control(TIMELINE_SEEK, 0, position_ms, 0, destination_address);
+}
+
+
+void SuperPixie::save_timeline( bool autoplay, bool loop, uint32_t length_ms, uint8_t destination_address ){
+	uint8_t flags = ( loop ? TIMELINE_FLAG_LOOP : 0 ) | ( autoplay ? TIMELINE_FLAG_AUTOPLAY : 0 );
+	send_timeline_control(TIMELINE_SAVE, flags, 0, length_ms, destination_address);
+}
+
+
+void SuperPixie::clear_timeline( uint8_t destination_address ){
+	send_timeline_control(TIMELINE_CLEAR, 0, 0, 0, destination_address);
+}
+
+
+uint16_t SuperPixie::send_timeline_entry(uint8_t command_type, uint8_t destination_address, uint8_t data_length_in_bytes, uint8_t* command_data){
+	if(data_length_in_bytes > TIMELINE_MAX_COMMAND_DATA){
+		return 0; // Too big to record, like a whole RGB stream fragment
+	}
+
+	uint8_t entry_data[5 + TIMELINE_MAX_COMMAND_DATA] = {
+		uint8_t(timeline_time_ms >> 24), uint8_t(timeline_time_ms >> 16), uint8_t(timeline_time_ms >> 8), uint8_t(timeline_time_ms),
+		command_type,
+	};
+	if(data_length_in_bytes > 0){
+		memcpy(&entry_data[5], command_data, data_length_in_bytes);
+	}
+
+	return send_packet(COM_TIMELINE_ADD, destination_address, 5 + data_length_in_bytes, entry_data);
+}
+
+
+void SuperPixie::send_timeline_control(timeline_operation_t operation, uint8_t flags, uint32_t position_ms, uint32_t length_ms, uint8_t destination_address){
+	uint8_t control_data[10] = {
+		operation,
+		flags,
+		uint8_t(position_ms >> 24), uint8_t(position_ms >> 16), uint8_t(position_ms >> 8), uint8_t(position_ms),
+		uint8_t(length_ms >> 24), uint8_t(length_ms >> 16), uint8_t(length_ms >> 8), uint8_t(length_ms),
+	};
+
+	send_packet(COM_TIMELINE_CONTROL, destination_address, 10, control_data);
+}
+
+
 void SuperPixie::start_bus_mode(){
 	send_packet(COM_START_BUS_MODE, ADDRESS_BROADCAST, 0, nullptr);
 }
@@ -438,6 +630,221 @@ void SuperPixie::set_transition_interpolation( uint8_t interpolation_type ){
 
 
 
+void SuperPixie::set_gamma_curve( gamma_curve_t curve, float exponent, uint8_t destination_address ){
+	uint16_t exponent_x100 = exponent * 100;
+
+	uint8_t exponent_high = get_byte_from_16_bit(exponent_x100, 1);
+	uint8_t exponent_low  = get_byte_from_16_bit(exponent_x100, 0);
+
+	uint8_t gamma_data[3] = { curve, exponent_high, exponent_low };
+	send_packet(COM_SET_GAMMA_CURVE, destination_address, 3, gamma_data);
+}
+
+
+void SuperPixie::set_dither_mode( dither_mode_t mode, uint8_t min_flicker_hz, uint8_t destination_address ){
+	uint8_t dither_data[2] = { mode, min_flicker_hz };
+	send_packet(COM_SET_DITHER_MODE, destination_address, 2, dither_data);
+}
+
+
+void SuperPixie::set_easing_curve( uint8_t curve, const float* points, uint8_t destination_address ){
+	if( curve < CUSTOM_CURVE_A ){
+		return; // Built in curves can't be replaced
+	}
+
+	// (points) holds EASING_CUSTOM_POINTS values from 0.0-1.0, sent in halves since a whole
+	// curve doesn't fit in one packet
+	for( uint8_t first_point = 0; first_point < EASING_CUSTOM_POINTS; first_point += EASING_CUSTOM_POINTS_PER_PACKET ){
+		uint8_t curve_data[3 + EASING_CUSTOM_POINTS_PER_PACKET] = { uint8_t(curve - CUSTOM_CURVE_A), first_point, EASING_CUSTOM_POINTS_PER_PACKET };
+
+		for( uint8_t i = 0; i < EASING_CUSTOM_POINTS_PER_PACKET; i++ ){
+			float point = points[first_point + i];
+			if( point < 0.0 ){ point = 0.0; }
+			if( point > 1.0 ){ point = 1.0; }
+
+			curve_data[3 + i] = point * 255 + 0.5;
+		}
+
+		send_packet(COM_SET_EASING_CURVE, destination_address, 3 + EASING_CUSTOM_POINTS_PER_PACKET, curve_data);
+	}
+}
+
+
+void SuperPixie::set_transition_track( transition_type_t custom_transition, uint8_t track_index, transition_slot_t slot, transition_property_t property, uint8_t num_keyframes, const float* times, const float* values, uint8_t destination_address ){
+	if( custom_transition < TRANSITION_CUSTOM_A ){
+		return; // Built in transitions can't be replaced
+	}
+
+	if( num_keyframes > TRANSITION_MAX_KEYFRAMES ){
+		num_keyframes = TRANSITION_MAX_KEYFRAMES;
+	}
+
+	// Values are sent as signed fixed point: thousandths for opacity and scale, hundredths of an
+	// LED for position, and tenths of a degree for rotation
+	float steps = 1000.0;
+	if( property == TRANSITION_POSITION_X || property == TRANSITION_POSITION_Y ){ steps = 100.0; }
+	else if( property == TRANSITION_ROTATION ){ steps = 10.0; }
+
+	uint8_t track_data[5 + TRANSITION_MAX_KEYFRAMES * 3] = { custom_transition, track_index, slot, property, num_keyframes };
+	for( uint8_t i = 0; i < num_keyframes; i++ ){
+		float time = times[i];
+		if( time < 0.0 ){ time = 0.0; }
+		if( time > 1.0 ){ time = 1.0; }
+
+		int16_t value = values[i] * steps;
+
+		track_data[5 + i * 3 + 0] = time * TRANSITION_KEYFRAME_STEPS + 0.5;
+		track_data[5 + i * 3 + 1] = get_byte_from_16_bit(value, 1);
+		track_data[5 + i * 3 + 2] = get_byte_from_16_bit(value, 0);
+	}
+
+	send_packet(COM_SET_TRANSITION_TRACK, destination_address, 5 + num_keyframes * 3, track_data);
+}
+
+
+void SuperPixie::queue_sequence( const sequence_step* steps, uint8_t num_steps, bool replace, uint8_t destination_address ){
+	// Split into as many packets as needed, only the first one can clear the queue
+	for( uint8_t first_step = 0; first_step < num_steps; first_step += SEQUENCE_STEPS_PER_PACKET ){
+		uint8_t packet_steps = num_steps - first_step;
+		if( packet_steps > SEQUENCE_STEPS_PER_PACKET ){
+			packet_steps = SEQUENCE_STEPS_PER_PACKET;
+		}
+
+		uint8_t sequence_data[1 + SEQUENCE_STEPS_PER_PACKET * 6];
+		sequence_data[0] = ( replace == true && first_step == 0 ) ? 1 : 0;
+
+		for( uint8_t i = 0; i < packet_steps; i++ ){
+			const sequence_step& step = steps[first_step + i];
+			uint8_t* step_data = &sequence_data[1 + i * 6];
+
+			step_data[0] = step.character;
+			step_data[1] = step.transition_type;
+			step_data[2] = get_byte_from_16_bit(step.transition_duration_ms, 1);
+			step_data[3] = get_byte_from_16_bit(step.transition_duration_ms, 0);
+			step_data[4] = get_byte_from_16_bit(step.hold_ms, 1);
+			step_data[5] = get_byte_from_16_bit(step.hold_ms, 0);
+		}
+
+		send_packet(COM_QUEUE_SEQUENCE, destination_address, 1 + packet_steps * 6, sequence_data);
+	}
+}
+
+
+void SuperPixie::set_stream_palette( const CRGB* palette, uint8_t num_entries, uint8_t destination_address ){
+	if( num_entries > STREAM_PALETTE_SIZE ){
+		num_entries = STREAM_PALETTE_SIZE;
+	}
+
+	uint8_t stream_data[STREAM_FRAGMENT_HEADER + STREAM_PALETTE_SIZE * 3] = { stream_sequence, STREAM_SET_PALETTE, 0 };
+	for( uint8_t i = 0; i < num_entries; i++ ){
+		stream_data[STREAM_FRAGMENT_HEADER + i * 3 + 0] = palette[i].r;
+		stream_data[STREAM_FRAGMENT_HEADER + i * 3 + 1] = palette[i].g;
+		stream_data[STREAM_FRAGMENT_HEADER + i * 3 + 2] = palette[i].b;
+	}
+
+	send_packet(COM_STREAM_FRAME, destination_address, STREAM_FRAGMENT_HEADER + num_entries * 3, stream_data);
+}
+
+
+void SuperPixie::stream_frame( const CRGB* pixels, uint8_t destination_address ){
+	// STREAM_PIXELS colors, split into fragments of as many whole pixels as fit in a packet
+	const uint8_t pixels_per_fragment = STREAM_MAX_FRAGMENT_DATA / 3;
+	stream_sequence++;
+
+	for( uint8_t first_pixel = 0; first_pixel < STREAM_PIXELS; first_pixel += pixels_per_fragment ){
+		uint8_t fragment_pixels = STREAM_PIXELS - first_pixel;
+		if( fragment_pixels > pixels_per_fragment ){
+			fragment_pixels = pixels_per_fragment;
+		}
+
+		uint8_t stream_data[STREAM_FRAGMENT_HEADER + STREAM_MAX_FRAGMENT_DATA] = { stream_sequence, STREAM_RGB, first_pixel };
+		for( uint8_t i = 0; i < fragment_pixels; i++ ){
+			const CRGB& pixel = pixels[first_pixel + i];
+			stream_data[STREAM_FRAGMENT_HEADER + i * 3 + 0] = pixel.r;
+			stream_data[STREAM_FRAGMENT_HEADER + i * 3 + 1] = pixel.g;
+			stream_data[STREAM_FRAGMENT_HEADER + i * 3 + 2] = pixel.b;
+		}
+
+		send_packet(COM_STREAM_FRAME, destination_address, STREAM_FRAGMENT_HEADER + fragment_pixels * 3, stream_data);
+	}
+}
+
+
+void SuperPixie::stream_frame( const uint8_t* palette_indices, bool run_length_encode, uint8_t destination_address ){
+	// STREAM_PIXELS entries of the palette set with set_stream_palette(), either packed two to a
+	// byte or as runs of up to 16 pixels of the same entry. A run never spans two fragments,
+	// since every fragment says which pixel it starts at.
+	uint8_t encoding = ( run_length_encode == true ) ? STREAM_RLE : STREAM_PALETTE;
+	stream_sequence++;
+
+	uint8_t pixel = 0;
+	while( pixel < STREAM_PIXELS ){
+		uint8_t stream_data[STREAM_FRAGMENT_HEADER + STREAM_MAX_FRAGMENT_DATA] = { stream_sequence, encoding, pixel };
+		uint8_t fragment_length = 0;
+
+		while( pixel < STREAM_PIXELS && fragment_length < STREAM_MAX_FRAGMENT_DATA ){
+			uint8_t entry = palette_indices[pixel] & ( STREAM_PALETTE_SIZE - 1 );
+
+			if( encoding == STREAM_RLE ){
+				uint8_t run_length = 1;
+				while( run_length < 16 && pixel + run_length < STREAM_PIXELS && ( palette_indices[pixel + run_length] & ( STREAM_PALETTE_SIZE - 1 ) ) == entry ){
+					run_length++;
+				}
+
+				stream_data[STREAM_FRAGMENT_HEADER + fragment_length] = ( ( run_length - 1 ) << 4 ) + entry;
+				pixel += run_length;
+			}
+			else{
+				uint8_t next_entry = 0;
+				if( pixel + 1 < STREAM_PIXELS ){
+					next_entry = palette_indices[pixel + 1] & ( STREAM_PALETTE_SIZE - 1 );
+				}
+
+				stream_data[STREAM_FRAGMENT_HEADER + fragment_length] = ( entry << 4 ) + next_entry;
+				pixel += 2;
+			}
+
+			fragment_length++;
+		}
+
+		send_packet(COM_STREAM_FRAME, destination_address, STREAM_FRAGMENT_HEADER + fragment_length, stream_data);
+	}
+}
+
+
+void SuperPixie::stop_stream( uint8_t destination_address ){
+	// Also resets the node's sequence numbers, so the next stream can start from anywhere
+	uint8_t stream_data[STREAM_FRAGMENT_HEADER] = { stream_sequence, STREAM_STOP, 0 };
+	send_packet(COM_STREAM_FRAME, destination_address, STREAM_FRAGMENT_HEADER, stream_data);
+}
+
+
+void SuperPixie::spawn_effect( effect_type_t type, CRGB color_start, CRGB color_end, float position_start, float position_end, float width_start, float width_end, float opacity_start, float opacity_end, uint16_t duration_ms, uint8_t interpolation_type, uint16_t delay_ms, uint8_t destination_address ){
+	// Positions and widths are sent as signed hundredths of an LED
+	int16_t position_start_x100 = position_start * 100;
+	int16_t position_end_x100 = position_end * 100;
+	int16_t width_start_x100 = width_start * 100;
+	int16_t width_end_x100 = width_end * 100;
+
+	uint8_t effect_data[22] = {
+		type,
+		interpolation_type,
+		color_start.r, color_start.g, color_start.b,
+		color_end.r, color_end.g, color_end.b,
+		get_byte_from_16_bit(position_start_x100, 1), get_byte_from_16_bit(position_start_x100, 0),
+		get_byte_from_16_bit(position_end_x100, 1), get_byte_from_16_bit(position_end_x100, 0),
+		get_byte_from_16_bit(width_start_x100, 1), get_byte_from_16_bit(width_start_x100, 0),
+		get_byte_from_16_bit(width_end_x100, 1), get_byte_from_16_bit(width_end_x100, 0),
+		uint8_t(opacity_start * 255), uint8_t(opacity_end * 255),
+		get_byte_from_16_bit(duration_ms, 1), get_byte_from_16_bit(duration_ms, 0),
+		get_byte_from_16_bit(delay_ms, 1), get_byte_from_16_bit(delay_ms, 0),
+	};
+	send_packet(COM_SPAWN_EFFECT, destination_address, 22, effect_data);
+}
+
+
+
+
 void SuperPixie::send_probe_response(uint8_t origin_address) {
   uint8_t flags = 0;
   bool is_commander = true;
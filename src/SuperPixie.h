@@ -56,10 +56,71 @@ typedef enum {
   TRANSITION_PUSH_DOWN,
   TRANSITION_PUSH_LEFT,
   TRANSITION_PUSH_RIGHT,
+  TRANSITION_CUSTOM_A,
+  TRANSITION_CUSTOM_B,
+  TRANSITION_CUSTOM_C,
+  TRANSITION_CUSTOM_D,
 
   NUM_TRANSITIONS
 } transition_type_t;
 
+// Properties of a character that a custom transition track can animate
+typedef enum {
+  TRANSITION_OPACITY,     // 0.0-1.0
+  TRANSITION_POSITION_X,  // LEDs
+  TRANSITION_POSITION_Y,  // LEDs
+  TRANSITION_SCALE_X,     // 1.0 is full size
+  TRANSITION_SCALE_Y,
+  TRANSITION_ROTATION,    // Degrees
+} transition_property_t;
+
+// Which character a custom transition track animates
+typedef enum {
+  TRANSITION_INCOMING,
+  TRANSITION_OUTGOING,
+} transition_slot_t;
+
+// One character of a sequence queued with queue_sequence(), played back by the SuperPixie itself
+struct sequence_step {
+  char character;
+  transition_type_t transition_type;
+  uint16_t transition_duration_ms;
+  uint16_t hold_ms;  // How long the character stays on screen after its transition
+};
+
+#define SEQUENCE_STEPS_PER_PACKET 9
+
+#define MARQUEE_MAX_LENGTH 48  // Longest string a marquee can scroll
+
+#define CLOCK_MAX_FORMAT 32
+#define CLOCK_FLAG_STOP_AT_ZERO (0x01)
+
+#define STREAM_WIDTH 7
+#define STREAM_HEIGHT 15
+#define STREAM_PIXELS (STREAM_WIDTH * STREAM_HEIGHT)  // Row by row from the top left
+#define STREAM_FRAGMENT_HEADER 3
+#define STREAM_MAX_FRAGMENT_DATA 51
+#define STREAM_PALETTE_SIZE 16
+
+#define TIMELINE_MAX_COMMAND_DATA 49  // Largest command a timeline entry can hold
+
+#define TIMELINE_FLAG_LOOP (0x01)
+#define TIMELINE_FLAG_AUTOPLAY (0x02)
+
+// Operations of COM_TIMELINE_CONTROL
+typedef enum {
+  TIMELINE_CLEAR,
+  TIMELINE_PLAY,
+  TIMELINE_PAUSE,
+  TIMELINE_RESUME,
+  TIMELINE_SEEK,
+  TIMELINE_SAVE,
+  TIMELINE_LOAD,
+} timeline_operation_t;
+
+#define TRANSITION_KEYFRAME_STEPS 240  // Keyframe times run from 0 to this
+#define TRANSITION_MAX_KEYFRAMES 8
+
 typedef enum {
   GRADIENT_NONE,
   GRADIENT_HORIZONTAL,
@@ -78,6 +139,73 @@ enum interpolation_types {
   EASE_OUT_SOFT,
   S_CURVE,
   S_CURVE_SOFT,
+  CUSTOM_CURVE_A,
+  CUSTOM_CURVE_B,
+  CUSTOM_CURVE_C,
+  CUSTOM_CURVE_D,
+};
+
+// Number of evenly spaced points in a curve sent with set_easing_curve()
+#define EASING_CUSTOM_POINTS 64
+#define EASING_CUSTOM_POINTS_PER_PACKET 32
+
+// A list of all possible gamma/transfer curves
+typedef enum {
+  GAMMA_LINEAR,
+  GAMMA_SQUARE,
+  GAMMA_POWER,
+  GAMMA_SRGB,
+
+  NUM_GAMMA_CURVES
+} gamma_curve_t;
+
+// A list of all possible temporal dithering modes
+typedef enum {
+  DITHER_FIXED,
+  DITHER_ADAPTIVE,
+} dither_mode_t;
+
+// A list of all possible effects a SuperPixie can run on its own
+typedef enum {
+  EFFECT_RIPPLE,
+  EFFECT_SWEEP,
+  EFFECT_SPARKLE,
+  EFFECT_PULSE,
+} effect_type_t;
+
+// Encodings of host rendered frames streamed with stream_frame()
+typedef enum {
+  STREAM_RGB,
+  STREAM_PALETTE,
+  STREAM_RLE,
+  STREAM_SET_PALETTE,
+  STREAM_STOP,
+} stream_encoding_t;
+
+// Stages of a node's frame timed by its profiler, read back with get_profile()
+typedef enum {
+  PROFILE_FRAME,
+  PROFILE_RENDER_STATE,
+  PROFILE_TRANSITION,
+  PROFILE_BACKLIGHT,
+  PROFILE_BACKGROUND,
+  PROFILE_CHARACTERS,
+  PROFILE_STREAM,
+  PROFILE_DEBUG,
+  PROFILE_EFFECTS,
+  PROFILE_TOUCH,
+  PROFILE_COMPOSITE,
+  PROFILE_BRIGHTNESS,
+  PROFILE_OUTPUT,
+
+  NUM_PROFILE_STAGES
+} profile_stage_t;
+
+// How long one stage took, in microseconds, over every frame since the last reset
+struct stage_profile {
+  uint16_t min_us;
+  uint16_t avg_us;
+  uint16_t p99_us;  // 99% of frames took this long or less, to within 1/8th
 };
 
 // Possible UART commands
@@ -116,6 +244,18 @@ typedef enum {
   /* 31 */ COM_READ_TOUCH_RESPONSE,
   /* 32 */ COM_SET_TOUCH_THRESHOLD,
   /* 33 */ COM_SAVE_STORAGE,
+  /* 34 */ COM_SET_GAMMA_CURVE,
+  /* 35 */ COM_SET_DITHER_MODE,
+  /* 36 */ COM_SPAWN_EFFECT,
+  /* 37 */ COM_SET_EASING_CURVE,
+  /* 38 */ COM_SET_TRANSITION_TRACK,
+  /* 39 */ COM_QUEUE_SEQUENCE,
+  /* 40 */ COM_SET_MARQUEE,
+  /* 41 */ COM_STREAM_FRAME,
+  /* 42 */ COM_TIMELINE_ADD,
+  /* 43 */ COM_TIMELINE_CONTROL,
+  /* 44 */ COM_SET_CLOCK,
+  /* 45 */ COM_FPS_RESPONSE,
   
   NUM_COMMANDS
 } command_t;
@@ -137,6 +277,10 @@ class SuperPixie{
 		/*+-- Functions - print(  ) --------------------------------------------------------*/ 
 		/*|*/ void set_string( char* string );
 		/*|*/ void set_character( uint8_t new_character, uint8_t destination_address = ADDRESS_BROADCAST );		
+		/*|*/ void start_marquee( char* string, float speed, float pitch = 12.0, bool loop = true, uint16_t delay_ms = 100 );
+		/*|*/ void stop_marquee();
+		/*|*/ void start_clock( const char* format, int32_t base, int16_t step = 1, uint16_t tick_ms = 1000, uint16_t delay_ms = 0, bool stop_at_zero = false, uint8_t first_address = 0 );
+		/*|*/ void stop_clock();
 		/*+-- Functions - Updating the mask/LEDs -------------------------------------------*/
 		/*|*/ uint16_t send_packet(uint8_t command_type, uint8_t destination_address, uint8_t data_length_in_bytes, uint8_t* command_data);
 
@@ -151,10 +295,31 @@ class SuperPixie{
 		/*|*/ void set_backlight_color( CRGB col, uint8_t destination_address = ADDRESS_BROADCAST );
 		/*|*/ void set_debug_overlay_opacity( float opacity, uint8_t destination_address = ADDRESS_BROADCAST );
 		/*|*/ void set_transition_interpolation( uint8_t interpolation_type );
+		/*|*/ void set_gamma_curve( gamma_curve_t curve, float exponent = 2.0, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void set_dither_mode( dither_mode_t mode, uint8_t min_flicker_hz = 100, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void set_easing_curve( uint8_t curve, const float* points, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void set_transition_track( transition_type_t custom_transition, uint8_t track_index, transition_slot_t slot, transition_property_t property, uint8_t num_keyframes, const float* times, const float* values, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void queue_sequence( const sequence_step* steps, uint8_t num_steps, bool replace = false, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void set_stream_palette( const CRGB* palette, uint8_t num_entries, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void stream_frame( const CRGB* pixels, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void stream_frame( const uint8_t* palette_indices, bool run_length_encode, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void stop_stream( uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void spawn_effect( effect_type_t type, CRGB color_start, CRGB color_end, float position_start, float position_end, float width_start, float width_end, float opacity_start, float opacity_end, uint16_t duration_ms, uint8_t interpolation_type = LINEAR, uint16_t delay_ms = 0, uint8_t destination_address = ADDRESS_BROADCAST );
 		/*|*/ void clear();
 		/*|*/ void show();
 		/*|*/ void wait();
+		/*+-- Functions - Timelines --------------------------------------------------------*/
+		/*|*/ void begin_timeline( bool clear_first = true, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void set_timeline_time( uint32_t time_ms );
+		/*|*/ void end_timeline();
+		/*|*/ void play_timeline( bool loop = true, uint32_t length_ms = 0, uint32_t position_ms = 0, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void pause_timeline( uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void resume_timeline( uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void seek_timeline( uint32_t position_ms, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void save_timeline( bool autoplay, bool loop = true, uint32_t length_ms = 0, uint8_t destination_address = ADDRESS_BROADCAST );
+		/*|*/ void clear_timeline( uint8_t destination_address = ADDRESS_BROADCAST );
 		/*+-- Functions - Debug ------------------------------------------------------------*/
+		/*|*/ bool get_profile( uint8_t destination_address, stage_profile* stages, bool reset = false );
 
 		/*+---------------------------------------------------------------------------------*/
 
@@ -172,6 +337,16 @@ class SuperPixie{
 		bool chain_initialized = false;
 		bool bus_ready = false;
 		
+		uint8_t stream_sequence = 0;  // Incremented for every frame streamed
+
+		// While recording, send_packet() adds commands to the nodes' timelines instead
+		bool timeline_recording = false;
+		uint32_t timeline_time_ms = 0;
+
+		// Filled in by COM_FPS_RESPONSE packets during get_profile()
+		stage_profile* profile_stages = nullptr;
+		volatile uint8_t profile_stages_received = 0;
+
 		bool show_complete = true;
 		bool show_called_once = false;
 		
@@ -195,6 +370,8 @@ class SuperPixie{
 		void end_bus_mode();
 		
 		void send_probe_response(uint8_t origin_address);
+		uint16_t send_timeline_entry(uint8_t command_type, uint8_t destination_address, uint8_t data_length_in_bytes, uint8_t* command_data);
+		void send_timeline_control(timeline_operation_t operation, uint8_t flags, uint32_t position_ms, uint32_t length_ms, uint8_t destination_address);
 		void execute_packet(uint8_t origin_address, uint16_t packet_id, uint8_t command_type, uint8_t data_length_in_bytes);
 		void parse_packet();
 		void finalize_packet();